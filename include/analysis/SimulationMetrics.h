@@ -4,6 +4,9 @@
 #include <string>
 #include <vector>
 
+#include "../domains/StoragePolicy.h"
+#include "../utils/SlabAllocator.h"
+
 //@ Forward declarations
 struct ConfigData;
 class Warehouse;
@@ -27,6 +30,9 @@ class SimulationMetrics {
         double averageWaitTime;
         int packagesInTransit;
         double throughput; // pacotes/unidade_tempo_simulacao
+
+        // Alocações por tipo nos pools (SlabPool) entre startTimer e stopTimer
+        std::vector<SlabPoolStats> allocationStats;
     };
 
     //@ Estrutura para armazenar resultados de múltiplos testes
@@ -52,6 +58,13 @@ class SimulationMetrics {
     int totalProcessingTime;
     double actualSimulationTime;
 
+    // Estatísticas dos pools de alocação no início e no fim da medição
+    std::vector<SlabPoolStats> allocationsAtStart;
+    std::vector<SlabPoolStats> allocationsAtStop;
+
+    //@ Lê as estatísticas de todos os pools de alocação
+    static std::vector<SlabPoolStats> captureAllocationStats();
+
   public:
     //@ Construtor
     SimulationMetrics();
@@ -84,7 +97,8 @@ class SimulationMetrics {
     Metrics calculateMetrics(const ConfigData& config);
 
     //@ Executa uma simulação e coleta métricas
-    static Metrics runSimulationWithMetrics(const std::string& configFile);
+    //@ @param storagePolicy Disciplina de armazenamento das seções
+    static Metrics runSimulationWithMetrics(const std::string& configFile, StoragePolicy storagePolicy = LIFO_STORAGE);
 
     //@ Executa experimento variando número de armazéns
     static ExperimentResult runWarehouseScalingExperiment();
@@ -95,6 +109,16 @@ class SimulationMetrics {
     //@ Executa experimento variando contenção de transporte
     static ExperimentResult runTransportContentionExperiment();
 
+    //@ Executa experimento comparando as disciplinas de armazenamento sob contenção máxima
+    //@ O tamanho de entrada de cada resultado é o valor da StoragePolicy usada
+    static ExperimentResult runStoragePolicyExperiment();
+
+    //@ Calcula e salva <configFile>.rt para um arquivo que será carregado várias vezes no mesmo experimento
+    //@ Só vale para topologias reaproveitadas: um arquivo carregado uma única vez pagaria a tabela inteira sem retorno
+    //@ @param extended Se o arquivo está no formato estendido
+    //@ @return false se a tabela não pôde ser calculada ou salva (as cargas apenas voltam a calcular as rotas)
+    static bool prepareRouteTable(const std::string& configFile, bool extended = false);
+
     //@ Salva resultados em arquivo CSV
     static void saveResultsToCSV(const ExperimentResult& results, const std::string& filename);
 
@@ -1,10 +1,23 @@
 #pragma once
 
 #include "../dataStructures/Graph.h"
+#include "../domains/StoragePolicy.h"
 
 //@ Forward declarations
 class Warehouse;
-class Package;
+class PackageTable;
+class RouteArena;
+class RouteTable;
+class RegionArena;
+class ThreadPool;
+
+//@ Enum que define a numeração interna dos armazéns escolhida na carga
+//@ INPUT_ORDER mantém os IDs do arquivo; as demais renumeram para aproximar vizinhos na memória
+enum WarehouseOrdering {
+    INPUT_ORDER,
+    BFS_ORDER, // Ordem de descoberta de uma BFS por componente
+    RCM_ORDER, // Cuthill-McKee reverso (reduz a largura de banda da matriz de adjacência)
+};
 
 //@ Estrutura que guarda os dados de configuração lidos do arquivo de entrada
 struct ConfigData {
@@ -16,12 +29,32 @@ struct ConfigData {
     int numPackages;
     Graph* graph;
     Warehouse** warehouses;
-    Package** packages;
+    PackageTable* packageTable; // Colunas dos atributos dos pacotes, na ordem do arquivo (nullptr sem pacotes)
+    RouteArena* routes;     // Rotas internadas dos pacotes deste cenário, criada na região
+    ThreadPool* pool;       // Threads do cenário, criadas uma vez na região e usadas por todos os laços paralelos
+    RouteTable* routeTable; // Tabela de rotas mapeada de <entrada>.rt (nullptr se ausente ou de outra topologia)
+    bool lazyRouting;       // Rotas calculadas pelo escalonador na primeira chegada de cada pacote, e não antes da simulação
+    StoragePolicy storagePolicy; // Disciplina das seções de todos os armazéns
+    int* externalIds;       // ID do arquivo de cada armazém interno, na região (nullptr se a ordem do arquivo foi mantida)
+    RegionArena* arena;     // Região de onde vêm pacotes, armazéns, suas seções e os vetores de ponteiros (liberada de uma vez)
 
     //@ Construtor padrão
     ConfigData();
 };
 
 //@ Funções para carregar e limpar dados de configuração
-ConfigData loadInput(const std::string& filename);
-void cleanup(ConfigData& data);
\ No newline at end of file
+//@ Com uma ordenação diferente de INPUT_ORDER os armazéns são renumerados após a leitura do grafo;
+//@ os logs e o desempate de eventos continuam usando os IDs do arquivo (ver externalIds)
+//@ Se existir <entrada>.rt calculado para a mesma topologia (e a mesma ordenação), ele é mapeado em routeTable
+//@ Pacotes e armazéns são criados na região data.arena (em páginas grandes se hugePages), e cleanup a libera inteira
+//@ Os armazéns são criados com a disciplina de armazenamento storagePolicy
+ConfigData loadInput(const std::string& filename, WarehouseOrdering ordering = INPUT_ORDER, bool hugePages = false, StoragePolicy storagePolicy = LIFO_STORAGE);
+void cleanup(ConfigData& data);
+
+//@ Função que calcula a tabela de rotas (<entrada>.rt) de um arquivo base, com a ordenação que a simulação usará
+//@ Não calcula as rotas dos pacotes: a tabela é construída direto do grafo
+RouteTable* buildRouteTable(const std::string& filename, WarehouseOrdering ordering = INPUT_ORDER, int numThreads = 0);
+
+//@ Função que calcula uma nova numeração dos armazéns
+//@ @return Vetor (alocado com new[]) em que a posição k guarda o ID original do armazém que recebe o ID k
+int* computeWarehouseOrder(const Graph& graph, WarehouseOrdering ordering);
\ No newline at end of file
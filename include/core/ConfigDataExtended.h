@@ -2,11 +2,18 @@
 
 #include "../dataStructures/Graph.h"
 #include "ConfigData.h"
+#include "Event.h"
 
 //@ Forward declarations
 class WarehouseExtended;
-class PackageExtended;
 class GraphExtended;
+class RouteTable;
+class RouteArena;
+class RegionArena;
+class ThreadPool;
+
+//@ Maior peso sorteado para um pacote quando o peso é variável (os pesos vão de 1 a MAX_PACKAGE_WEIGHT)
+constexpr int MAX_PACKAGE_WEIGHT = 10;
 
 //@ Estrutura que guarda os dados de configuração estendidos com pontos extras
 struct ConfigDataExtended {
@@ -25,16 +32,41 @@ struct ConfigDataExtended {
     bool limitedStorageCapacity;
     bool multipleRoutes;
     bool dynamicRouting;
+    bool contractionHierarchy; // Roteamento por hierarquia de contração (salva em <entrada>.ch)
+    bool timeDependentRouting; // Rotas de chegada mais cedo com latência avaliada no instante de cada aresta
+    bool lazyRouting;          // Rota calculada na primeira chegada do pacote, com as latências do instante da postagem
+    bool hugePages;            // Região do cenário mapeada em páginas grandes, quando o sistema permite
+    bool adaptiveCapacity;     // Capacidade das seções rebalanceada a cada intervalo de transporte conforme a demanda
+    int maxAlternativeRoutes;  // Rotas candidatas (k) avaliadas no roteamento dinâmico, token "k=" na linha de flags
+    StoragePolicy storagePolicy; // Disciplina das seções, token "armazenamento=" na linha de flags (lifo se ausente)
 
     // Estruturas estendidas
     GraphExtended* graph;
     WarehouseExtended** warehouses;
-    PackageExtended** packages;
+    PackageTable* packageTable; // Colunas dos atributos dos pacotes, com as estendidas, na ordem do arquivo (nullptr sem pacotes)
+    RouteArena* routes;         // Rotas internadas dos pacotes deste cenário, criada na região
+    ThreadPool* pool;           // Threads do cenário, criadas uma vez na região (carga, hierarquia e reencaminhamentos)
+    EdgeChange* edgeChanges; // Mudanças de aresta programadas, linhas "mudanca" da seção do grafo
+    int numEdgeChanges;
+    RouteTable* routeTable; // Tabela de rotas mapeada de <entrada>.rt (nullptr se ausente, de outra topologia ou com hierarquia)
+    RegionArena* arena;     // Região de onde vêm pacotes, armazéns, suas seções e os vetores de ponteiros (liberada de uma vez)
 
     //@ Construtor padrão
     ConfigDataExtended();
 };
 
 //@ Funções para carregar e limpar dados de configuração estendidos
+//@ Se existir <entrada>.rt com os pesos dos pacotes, as rotas iniciais vêm dele em vez do Dijkstra
+//@ Pacotes e armazéns são criados na região data.arena, e cleanupExtended a libera inteira
 ConfigDataExtended loadInputExtended(const std::string& filename);
-void cleanupExtended(ConfigDataExtended& data);
\ No newline at end of file
+void cleanupExtended(ConfigDataExtended& data);
+
+//@ Função que carrega só os parâmetros e a topologia (grafo, mudanças de aresta e hierarquia de contração)
+//@ Não cria armazéns nem pacotes e não calcula rotas: serve às ferramentas que só consultam o grafo
+//@ O resultado também deve ser liberado com cleanupExtended
+ConfigDataExtended loadTopologyExtended(const std::string& filename);
+
+//@ Função que calcula a tabela de rotas (<entrada>.rt) de um arquivo estendido, carregando só a topologia
+//@ Só o peso 1, ou todos os pesos de 1 a MAX_PACKAGE_WEIGHT se a rota depender do peso do pacote
+//@ Lança std::runtime_error se a topologia não puder ser carregada
+RouteTable* buildRouteTableExtended(const std::string& filename, int numThreads = 0);
\ No newline at end of file
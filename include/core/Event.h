@@ -1,9 +1,28 @@
 #pragma once
 
+#include <cstddef>
+
 #include "domains/Package.h"
 
 //@ Enumeração que define os tipos de eventos na simulação
-enum EventType { PACKAGE_ARRIVAL, LEAVE_TRANSPORT };
+//@ No mesmo instante, mudanças de aresta são aplicadas depois das chegadas e partidas
+enum EventType { PACKAGE_ARRIVAL, LEAVE_TRANSPORT, EDGE_CHANGE };
+
+//@ Enumeração que define as mudanças programadas de uma aresta (simulação estendida)
+enum EdgeChangeType {
+    EDGE_DISABLE, // Fecha a aresta nos dois sentidos
+    EDGE_ENABLE,  // Reabre uma aresta fechada
+    EDGE_LATENCY, // Define uma nova latência base
+};
+
+//@ Estrutura que descreve uma mudança de aresta programada no arquivo de entrada
+struct EdgeChange {
+    int time;
+    int from;
+    int to;
+    EdgeChangeType type;
+    int latency; // Nova latência base (apenas EDGE_LATENCY)
+};
 
 //@ Classe que implementa um evento da simulação
 class Event {
@@ -14,27 +33,47 @@ class Event {
     //@ Atributo que define a duração do evento
     int time;
 
-    //@ Atributo que define o pacote relacionado ao evento
+    //@ Atributo que define o índice na PackageTable do pacote relacionado ao evento (-1 se nenhum)
     //@ Este atributo é usado para eventos de chegada de pacotes
-    Package* package;
+    int packageIndex;
 
     //@ Atributos que definem os armazéns de origem e destino do evento
     //@ Esses atributos são usados para eventos de transporte
     int originWarehouseId, destinationSectionId;
 
+    //@ Atributos que definem a mudança de uma aresta entre originWarehouseId e destinationSectionId
+    //@ Esses atributos são usados para eventos de mudança de aresta
+    EdgeChangeType edgeChange;
+    int edgeLatency;
+
+    //@ IDs do arquivo de entrada de originWarehouseId e destinationSectionId, usados no desempate
+    //@ Calculados na criação, para que a reordenação dos armazéns não mude a ordem dos eventos
+    //@ Nas chegadas de pacotes originOrderKey é o ID do pacote (o evento não guarda o pacote, só o índice)
+    int originOrderKey, sectionOrderKey;
+
     //@ Construtor para eventos de chegada de pacotes
     //@ @param time Duração do evento
     //@ @param package Pacote relacionado ao evento
-    Event(int time, Package* package);
+    Event(int time, const Package& package);
 
     //@ Construtor para eventos de transporte
     //@ @param time Duração do evento
     //@ @param originWarehouseId ID do armazém de origem
     //@ @param destinationWarehouseId ID do armazém de destino
-    Event(int time, int originWarehouseId, int destinationSectionId);
+    //@ @param externalIds ID do arquivo de cada armazém interno (nullptr se a numeração for a do arquivo)
+    Event(int time, int originWarehouseId, int destinationSectionId, const int* externalIds = nullptr);
+
+    //@ Construtor para eventos de mudança de aresta
+    //@ @param change Mudança programada (o instante do evento é change.time)
+    Event(const EdgeChange& change);
 
     //@ Sobrecarga de operador de comparação
     //@ Essencial para funcionamento do MinHeap
     //@ @param other Evento a ser comparado
     bool operator<(const Event& other) const noexcept;
+
+    //@ Eventos são criados e destruídos a cada chegada e partida: vêm do pool de eventos (SlabPool), não do heap global
+    //@ Objetos de outro tamanho (classes derivadas) vêm do heap global, e o delete com tamanho os devolve para lá
+    static void* operator new(std::size_t size);
+    static void operator delete(void* event, std::size_t size) noexcept;
 };
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "../dataStructures/RouteService.h"
+#include "../utils/ThreadPool.h"
+#include <csignal>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//@ Protocolo binário do servidor de rotas (inteiros de 32/64 bits na ordem de bytes da máquina, apenas localhost)
+//@ Todo quadro começa com FrameHeader; o cliente pode enviar vários quadros sem esperar respostas (pipeline),
+//@ e as respostas voltam na mesma ordem
+//@ - QUERY: count consultas Query; a resposta traz, para cada uma, latência (-1 se não houver rota),
+//@   número de armazéns da rota e os armazéns
+//@ - STATS: sem carga; a resposta traz em count o número de consultas medidas e cinco int64 em microssegundos
+//@   (p50, p90, p99, máximo e média) do tempo entre a chegada do quadro e a resposta pronta; os percentis
+//@   vêm de um histograma e têm erro relativo de até 1/16 (máximo e média são exatos)
+//@ - SHUTDOWN: sem carga; a resposta é um cabeçalho vazio e o servidor encerra após enviá-la
+namespace RouteProtocol {
+
+constexpr uint32_t MAGIC = 0x31515452; // "RTQ1"
+
+enum FrameType : uint32_t { QUERY = 1, STATS = 2, SHUTDOWN = 3 };
+
+struct FrameHeader {
+    uint32_t magic;
+    uint32_t type;
+    uint32_t count;
+};
+
+struct Query {
+    int32_t origin;
+    int32_t destination;
+    int32_t weight;
+    int32_t time;
+};
+
+//@ Limite de consultas por quadro (quadros maiores encerram a conexão, assim como consultas com peso menor que 1)
+constexpr uint32_t MAX_QUERIES_PER_FRAME = 1u << 16;
+
+//@ Número de percentis/estatísticas em uma resposta STATS
+constexpr int NUM_STATS = 5;
+
+} // namespace RouteProtocol
+
+//@ Classe que implementa um histograma de latências de tamanho fixo (log-linear: 16 faixas por potência de 2)
+//@ Registrar é O(1) e a memória não cresce com o número de consultas; valores abaixo de 16 são exatos e os
+//@ demais caem em faixas de largura até 1/16 do valor, então os percentis têm erro relativo de até 1/16
+class LatencyHistogram {
+  private:
+    //@ Bits de subdivisão de cada potência de 2 e número de faixas (cobre todo int64 não negativo)
+    static constexpr int SUB_BITS = 4;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int NUM_BUCKETS = (64 - SUB_BITS) * SUB_BUCKETS;
+
+    //@ Contagem por faixa, número de valores, soma e maior valor registrados
+    int64_t buckets[NUM_BUCKETS];
+    int64_t count;
+    int64_t sum;
+    int64_t maximum;
+
+    //@ Funções que convertem um valor em faixa e uma faixa no maior valor que ela contém
+    static int bucketOf(int64_t value) noexcept;
+    static int64_t upperBound(int bucket) noexcept;
+
+  public:
+    //@ Construtor (histograma vazio)
+    LatencyHistogram() noexcept;
+
+    //@ Registra times ocorrências de value (valores negativos contam como 0)
+    void record(int64_t value, int64_t times = 1) noexcept;
+
+    //@ Função que retorna o número de valores registrados
+    int64_t getCount() const noexcept;
+
+    //@ Preenche p50, p90, p99, máximo e média (zeros se vazio)
+    void getStats(int64_t stats[RouteProtocol::NUM_STATS]) const noexcept;
+};
+
+//@ Classe que implementa o servidor de rotas: carrega a topologia uma vez e responde consultas por um socket Unix
+//@ Um único laço de eventos (poll) atende várias conexões; cada quadro QUERY é resolvido em lote no RouteService
+class RouteDaemon {
+  private:
+    //@ Estado de uma conexão: bytes recebidos ainda não consumidos e resposta ainda não enviada
+    struct Connection {
+        int fd;
+        std::vector<char> input;
+        std::vector<char> output;
+        size_t outputOffset;
+    };
+
+    //@ Serviço de rotas e pool usado nos lotes
+    RouteService& service;
+    ThreadPool pool;
+
+    //@ Caminho e descritor do socket de escuta
+    std::string socketPath;
+    int listenFd;
+
+    //@ Conexões abertas
+    std::vector<Connection> connections;
+
+    //@ Latências das consultas atendidas, em microssegundos (memória fixa, qualquer que seja o tempo de execução)
+    LatencyHistogram latencies;
+
+    //@ Vetores reaproveitados entre quadros
+    std::vector<int> origins, destinations, weights;
+    std::vector<Route> routes;
+
+    //@ Indica que o servidor deve encerrar (pode ser alterado por um tratador de sinal)
+    volatile std::sig_atomic_t stopping;
+
+    //@ Consome os quadros completos do buffer de entrada, acumulando as respostas
+    //@ Retorna false se a conexão deve ser fechada por erro de protocolo
+    bool processFrames(Connection& connection, int64_t arrivalMicros);
+
+    //@ Resolve um quadro QUERY e escreve a resposta
+    void answerQueries(Connection& connection, const RouteProtocol::Query* queries, uint32_t count, int64_t arrivalMicros);
+
+    //@ Escreve a resposta de um quadro STATS
+    void answerStats(Connection& connection) const;
+
+    //@ Envia o que for possível da saída sem bloquear; retorna false se a conexão falhou
+    static bool flush(Connection& connection);
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param service Serviço de rotas (deve ter pelo menos numThreads trabalhadores)
+    //@ @param socketPath Caminho do socket Unix (um arquivo existente é substituído)
+    //@ @param numThreads Threads usadas nos lotes (0 usa todos os núcleos)
+    RouteDaemon(RouteService& service, const std::string& socketPath, int numThreads = 0);
+    ~RouteDaemon();
+
+    RouteDaemon(const RouteDaemon&) = delete;
+    RouteDaemon& operator=(const RouteDaemon&) = delete;
+
+    //@ Atende conexões até receber SHUTDOWN ou até requestStop ser chamado
+    void run();
+
+    //@ Pede o encerramento do laço (seguro em tratadores de sinal)
+    void requestStop() noexcept;
+
+    //@ Percentis da latência por consulta (p50, p90, p99, máximo e média, em microssegundos)
+    void getLatencyStats(int64_t stats[RouteProtocol::NUM_STATS]) const;
+
+    //@ Função que retorna o número de consultas atendidas
+    int64_t getNumQueries() const noexcept;
+};
+
+//@ Classe que implementa um cliente bloqueante do servidor de rotas
+class RouteClient {
+  private:
+    //@ Descritor do socket conectado
+    int fd;
+
+  public:
+    //@ Conecta ao socket Unix; lança std::runtime_error se não conseguir
+    RouteClient(const std::string& socketPath);
+    ~RouteClient();
+
+    RouteClient(const RouteClient&) = delete;
+    RouteClient& operator=(const RouteClient&) = delete;
+
+    //@ Envia um quadro QUERY sem esperar a resposta
+    void sendQueries(const RouteProtocol::Query* queries, uint32_t count);
+
+    //@ Lê a resposta do próximo quadro QUERY
+    //@ @param routes Recebe, para cada consulta, a latência (-1 se não houver rota) seguida dos armazéns
+    void receiveRoutes(std::vector<std::vector<int>>& routes);
+
+    //@ Pede as estatísticas de latência do servidor; retorna o número de consultas medidas
+    int64_t requestStats(int64_t stats[RouteProtocol::NUM_STATS]);
+
+    //@ Pede o encerramento do servidor e espera a confirmação
+    void requestShutdown();
+
+    //@ Interrompe os dois sentidos da conexão: envios e recepções bloqueados em outras threads falham na hora
+    void abort() noexcept;
+};
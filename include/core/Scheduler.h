@@ -2,10 +2,16 @@
 
 #include "../dataStructures/Graph.h"
 #include "../dataStructures/MinHeap.h"
+#include "../domains/StoragePolicy.h"
 
 //@ Forward declaration das classes usadas
 class Warehouse;
+class Package;
+class PackageTable;
 struct ConfigData;
+namespace Routing {
+class OnDemandRouter;
+}
 
 //@ Classe que implementa um timer para controlar o tempo da simulação
 class Timer {
@@ -47,6 +53,25 @@ class Scheduler {
     //@ Atributo que guarda o número de pacotes ativos no sistema
     int activePackages;
 
+    //@ Disciplina de armazenamento das seções (define quais pacotes são removidos no transporte)
+    StoragePolicy storagePolicy;
+
+    //@ ID do arquivo de cada armazém interno, para logs e desempate de eventos (nullptr se a numeração for a do arquivo)
+    const int* externalIds;
+
+    //@ Roteador usado no modo sob demanda (nullptr quando as rotas vêm prontas da carga)
+    Routing::OnDemandRouter* router;
+
+    //@ Tabela dos pacotes do cenário (os eventos de chegada guardam só o índice do pacote)
+    PackageTable* packages;
+
+    //@ Vetor reaproveitado entre partidas para os pacotes retirados de uma seção (só cresce)
+    Package* departureBuffer;
+    int departureBufferCapacity;
+
+    //@ Função que traduz um ID interno de armazém para o ID do arquivo de entrada
+    int externalId(int internalId) const noexcept;
+
     //@ Função auxiliar que inicializa os eventos de transporte no grafo
     //@ @param graph Grafo que representa os armazéns e suas conexões
     //@ @param numWarehouses Número total de armazéns no sistema
@@ -62,6 +87,11 @@ class Scheduler {
     //@ @param warehouses Array de armazéns do sistema
     void handleTransportDeparture(Event* event, Warehouse** warehouses);
 
+    //@ Função que faz a partida de uma seção acessada pela frente (disciplinas diferentes de LIFO)
+    //@ Remove só os pacotes transportados, sem rearmazenar nenhum
+    //@ @param time Instante da partida
+    void departFromFront(Warehouse* originWarehouse, int originId, int sectionId, int time);
+
   public:
     //@ Construtor que inicializa o escalonador
     // @param maxEvents Capacidade máxima de eventos no escalonador
@@ -29,12 +29,37 @@ class SchedulerExtended {
     bool limitedStorageCapacity;
     bool multipleRoutes;
     bool dynamicRouting;
+    bool lazyRouting;
+    bool adaptiveCapacity;
+    int maxAlternativeRoutes;
+    StoragePolicy storagePolicy;
+
+    //@ Arena de rotas do cenário (desvios e reencaminhamentos são internados nela)
+    RouteArena* routes;
+
+    //@ Tabela dos pacotes do cenário (os eventos de chegada guardam só o índice do pacote)
+    PackageTable* packages;
+
+    //@ Threads do cenário, reaproveitadas em cada reencaminhamento em lote
+    ThreadPool* pool;
+
+    //@ Mudanças de aresta programadas (inseridas no heap no início da simulação)
+    const EdgeChange* edgeChanges;
+    int numEdgeChanges;
+
+    //@ Reaberturas de aresta ainda não aplicadas: sem nenhuma, um pacote sem caminho nunca será entregue
+    int pendingReopenings;
+
+    //@ Vetor reaproveitado entre partidas para os pacotes retirados de uma seção (só cresce)
+    PackageExtended* departureBuffer;
+    int departureBufferCapacity;
 
     //@ Contadores para métricas
     int routeRecalculations;
     int capacityOverflows;
     int weightOverflows;
     int alternativeRoutesUsed;
+    int undeliverablePackages;
 
   public:
     //@ Construtor
@@ -49,6 +74,9 @@ class SchedulerExtended {
     //@ Função para obter métricas da simulação
     void getSimulationMetrics(int& routeRecalc, int& capOverflow, int& weightOverflow, int& altRoutes);
 
+    //@ Função que retorna quantos pacotes foram descartados por não terem mais caminho até o destino
+    int getUndeliverablePackages() const noexcept;
+
   private:
     //@ Função para inicializar eventos de transporte
     void initializeTransportEvents(GraphExtended* graph, int numWarehouses);
@@ -59,17 +87,35 @@ class SchedulerExtended {
     //@ Função para lidar com partida de transporte
     void handleTransportDeparture(Event* event, WarehouseExtended** warehouses, GraphExtended* graph);
 
+    //@ Função para aplicar uma mudança de aresta e reencaminhar os pacotes afetados
+    void handleEdgeChange(Event* event, WarehouseExtended** warehouses, GraphExtended* graph);
+
+    //@ Reencaminha os pacotes armazenados cuja rota restante passa pela aresta from - to
+    //@ (from = -1: pelos que passam por alguma aresta fechada, como após uma reabertura)
+    //@ As novas rotas são calculadas em lote, com uma árvore por armazém onde há pacotes afetados
+    void rerouteStoredPackages(int from, int to, WarehouseExtended** warehouses, GraphExtended* graph);
+
+    //@ Descarta um pacote sem caminho até o destino (estado UNDELIVERABLE), para que a simulação possa terminar
+    void dropUndeliverable(PackageExtended& package, int location);
+
+    //@ Verifica se a rota restante de um pacote passa por alguma aresta fechada
+    bool remainingRouteUsesClosedEdge(const PackageExtended& package, const GraphExtended* graph) const;
+
     //@ Remove o próximo evento do heap
     Event* removeNextEvent();
 
-    //@ Calcula rota dinâmica para um pacote
-    void calculateDynamicRoute(PackageExtended* package, GraphExtended* graph, int currentTime);
+    //@ Calcula rota dinâmica para um pacote, escolhendo entre as k rotas mais curtas a menos congestionada
+    void calculateDynamicRoute(PackageExtended& package, WarehouseExtended** warehouses, GraphExtended* graph, int currentTime);
+
+    //@ Calcula a rota de um pacote na sua primeira chegada (modo sob demanda), no instante atual
+    //@ Sem múltiplas rotas o peso é ignorado e, sem caminho, a rota vira o salto direto origem -> destino
+    void routeOnPosting(PackageExtended& package, GraphExtended* graph, int currentTime);
 
     //@ Verifica se é necessário recalcular rota
-    bool shouldRecalculateRoute(PackageExtended* package, GraphExtended* graph, int currentTime);
+    bool shouldRecalculateRoute(const PackageExtended& package, GraphExtended* graph, int currentTime);
 
     //@ Lida com overflow de capacidade
-    void handleCapacityOverflow(PackageExtended* package, WarehouseExtended** warehouses, int numWarehouses);
+    void handleCapacityOverflow(PackageExtended& package, WarehouseExtended** warehouses, int numWarehouses);
 
     //@ Calcula capacidade de transporte dinâmica
     int calculateDynamicTransportCapacity(int origin, int destination, GraphExtended* graph);
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "IndexedMinHeap.h"
+#include <string>
+
+//@ Forward declarations
+class GraphExtended;
+class ThreadPool;
+
+//@ Classe que implementa uma hierarquia de contração (CH) sobre as latências do GraphExtended
+//@ O pré-processamento contrai os armazéns em paralelo (conjuntos independentes por rodada) e pode
+//@ ser salvo em disco; as consultas fazem uma busca bidirecional apenas por arestas ascendentes
+class ContractionHierarchy {
+  private:
+    //@ Número de vértices e hash da topologia usada na construção
+    int numVertices;
+    unsigned long long topologyHash;
+
+    //@ Posição de cada vértice na ordem de contração
+    int* rank;
+
+    //@ Grafo ascendente em formato CSR (arestas para vértices de rank maior)
+    //@ upMiddles guarda o vértice contraído de cada atalho (-1 para arestas originais)
+    int* upOffsets;
+    int* upTargets;
+    int* upWeights;
+    int* upMiddles;
+    int numUpEdges;
+    int numShortcuts;
+
+    //@ Vetores auxiliares das consultas, reaproveitados e limpos pela lista de tocados
+    int* forwardDist;
+    int* backwardDist;
+    int* forwardParent;
+    int* backwardParent;
+    int* touched;
+    int numTouched;
+    IndexedMinHeap* forwardHeap;
+    IndexedMinHeap* backwardHeap;
+
+    //@ Caminho desempacotado da última consulta e cadeia de pais usada na montagem
+    int* pathBuffer;
+    int* chainBuffer;
+    int pathLength;
+
+    //@ Construtor privado: instâncias vêm de build() ou loadFromFile()
+    ContractionHierarchy(int numVertices);
+
+    //@ Aloca os vetores auxiliares de consulta
+    void allocateQueryBuffers();
+
+    //@ Verifica a estrutura lida de um arquivo: rank é uma permutação, os deslocamentos são crescentes,
+    //@ as arestas sobem no rank e o vértice de cada atalho tem rank menor que os extremos (o desempacotamento termina)
+    //@ e liga os dois com arestas cuja soma é o peso do atalho
+    bool hasValidStructure() const noexcept;
+
+    //@ Retorna o índice da aresta ascendente entre dois vértices (-1 se não existir)
+    int findUpwardEdge(int u, int v) const noexcept;
+
+    //@ Acrescenta ao caminho os vértices da aresta (from, to), exceto from, expandindo atalhos
+    void unpackEdge(int from, int to);
+
+    //@ Marca um vértice como tocado pela consulta atual
+    void touch(int vertex) noexcept;
+
+  public:
+    //@ Destrutor
+    ~ContractionHierarchy();
+
+    ContractionHierarchy(const ContractionHierarchy&) = delete;
+    ContractionHierarchy& operator=(const ContractionHierarchy&) = delete;
+
+    //@ Constrói a hierarquia a partir das latências base do grafo (tempo zero, peso unitário)
+    //@ @param graph Grafo estendido de origem
+    //@ @param numThreads Número de threads do pré-processamento (0 usa todos os núcleos)
+    static ContractionHierarchy* build(const GraphExtended& graph, int numThreads = 0);
+
+    //@ Constrói a hierarquia com as threads de um pool já existente (as do cenário, na carga)
+    static ContractionHierarchy* build(const GraphExtended& graph, ThreadPool& pool);
+
+    //@ Carrega uma hierarquia salva; retorna nullptr se o arquivo não existir ou não corresponder ao grafo
+    static ContractionHierarchy* loadFromFile(const std::string& filename, const GraphExtended& graph);
+
+    //@ Salva a hierarquia em formato binário; retorna false em caso de falha de escrita
+    bool saveToFile(const std::string& filename) const;
+
+    //@ Calcula o hash (FNV-1a) das arestas e latências base do grafo
+    static unsigned long long computeTopologyHash(const GraphExtended& graph);
+
+    //@ Funções de acesso
+    int getNumVertices() const noexcept;
+    int getNumShortcuts() const noexcept;
+    unsigned long long getTopologyHash() const noexcept;
+
+    //@ Consulta ponto a ponto; retorna a distância (INT_MAX se inalcançável)
+    //@ O caminho completo, de origin a destination, fica disponível em getPath()
+    int query(int origin, int destination);
+
+    //@ Caminho da última consulta
+    const int* getPath() const noexcept;
+    int getPathLength() const noexcept;
+};
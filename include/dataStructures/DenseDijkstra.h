@@ -0,0 +1,67 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+
+//@ Classe que implementa o Dijkstra O(V²) para topologias completas ou quase completas.
+//@ As latências ficam em uma matriz de inteiros linha-a-linha alinhada, e tanto a escolha do
+//@ vértice de menor distância quanto o relaxamento de uma linha inteira são vetorizados
+//@ (AVX2 ou SSE4.1, escolhidos em tempo de execução, com fallback escalar)
+class DenseDijkstra {
+  public:
+    //@ Valor sentinela que indica ausência de aresta na matriz de latências
+    static constexpr int NO_EDGE = INT_MAX;
+
+    //@ Alinhamento em bytes das linhas da matriz e dos vetores auxiliares
+    static constexpr size_t ALIGNMENT = 32;
+
+  private:
+    //@ Número de vértices e passo (em inteiros) de cada linha alinhada
+    int numVertices;
+    int stride;
+
+    //@ Distância tentativa dos vértices ainda não visitados (INT_MAX para visitados)
+    int* key;
+
+    //@ Distância final de cada vértice (INT_MAX se inalcançável)
+    int* dist;
+
+    //@ Predecessor de cada vértice na árvore de caminhos mínimos
+    int* parent;
+
+    //@ Máscara de visitados (-1 visitado, 0 não visitado) usada no relaxamento vetorial
+    int* visited;
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param numVertices Número de vértices do grafo
+    DenseDijkstra(int numVertices);
+    ~DenseDijkstra();
+
+    DenseDijkstra(const DenseDijkstra&) = delete;
+    DenseDijkstra& operator=(const DenseDijkstra&) = delete;
+
+    //@ Executa a busca a partir de uma origem
+    //@ @param latencyMatrix Matriz numVertices x rowStride(numVertices) com NO_EDGE nas posições sem aresta
+    //@ @param origin Vértice de origem
+    //@ @param weightFactor Multiplicador aplicado (com truncamento) à latência de cada aresta
+    void run(const int* latencyMatrix, int origin, double weightFactor);
+
+    //@ Função que retorna a distância final de um vértice após run()
+    int getDistance(int vertex) const noexcept;
+
+    //@ Função que retorna o predecessor de um vértice após run()
+    int getParent(int vertex) const noexcept;
+
+    //@ Função que retorna o passo de linha (múltiplo de 8 inteiros) para n vértices
+    static int rowStride(int numVertices) noexcept;
+
+    //@ Aloca um vetor de inteiros alinhado a ALIGNMENT bytes
+    static int* allocateAligned(size_t count);
+
+    //@ Libera um vetor alocado com allocateAligned
+    static void freeAligned(int* data) noexcept;
+
+    //@ Função que retorna o nome do kernel escolhido em tempo de execução ("avx2", "sse4.1" ou "scalar")
+    static const char* getKernelName() noexcept;
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+
+//@ Classe que guarda as arestas de um grafo em CSR, com cada atributo em seu próprio vetor alinhado
+//@ Cada armazém ocupa um trecho contíguo de posições (slots), com os vizinhos em ordem crescente de ID;
+//@ arestas fechadas continuam guardadas (com seus atributos) até serem reabertas
+//@ Inserções durante a carga usam folga por linha: uma linha cheia é realocada no fim dos vetores,
+//@ e compact() volta ao CSR exato (linhas em ordem de armazém, sem folga)
+class EdgeStore {
+  public:
+    //@ Estados de uma aresta guardados em flags
+    static constexpr unsigned char EDGE_ACTIVE = 1;
+    static constexpr unsigned char EDGE_CLOSED = 2;
+
+  private:
+    //@ Número de vértices
+    int numVertices;
+
+    //@ Início, grau e capacidade do trecho de cada vértice
+    int* rowStart;
+    int* rowDegree;
+    int* rowCapacity;
+
+    //@ Posições usadas (incluindo folgas e buracos deixados por realocações) e capacidade dos vetores
+    int usedSlots;
+    int slotCapacity;
+
+    //@ Atributos por posição: vizinho, capacidade, latência base, multiplicador temporal, perfil e estado
+    int* targets;
+    int* capacities;
+    int* baseLatencies;
+    double* multipliers;
+    int* profileIndices;
+    unsigned char* flags;
+
+    //@ Realoca todos os vetores com capacidade newSlotCapacity, dispondo as linhas em ordem de vértice
+    //@ @param growRow Linha que recebe capacidade extra (-1 nenhuma)
+    //@ @param growCapacity Capacidade da linha growRow
+    void relayout(int newSlotCapacity, int growRow, int growCapacity);
+
+    //@ Garante espaço para mais uma aresta na linha i
+    void reserveInRow(int i);
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param numVertices Número de vértices (sem arestas inicialmente)
+    EdgeStore(int numVertices);
+    ~EdgeStore();
+
+    EdgeStore(const EdgeStore&) = delete;
+    EdgeStore& operator=(const EdgeStore&) = delete;
+
+    //@ Função que retorna a posição da aresta i -> j (-1 se não houver)
+    int find(int i, int j) const noexcept;
+
+    //@ Insere a aresta i -> j mantendo a ordem da linha e retorna sua posição
+    //@ Uma aresta nova começa inativa, com os atributos de EdgeInfo(); uma existente é apenas localizada
+    //@ Posições de outras arestas podem mudar a cada inserção
+    int insert(int i, int j);
+
+    //@ Reorganiza os vetores em CSR exato
+    void compact();
+
+    //@ Funções que retornam o trecho [rowBegin, rowEnd) das posições de um vértice
+    int rowBegin(int i) const noexcept { return rowStart[i]; }
+    int rowEnd(int i) const noexcept { return rowStart[i] + rowDegree[i]; }
+
+    //@ Funções que dão acesso aos atributos de uma posição
+    int target(int slot) const noexcept { return targets[slot]; }
+    int& capacity(int slot) noexcept { return capacities[slot]; }
+    int capacity(int slot) const noexcept { return capacities[slot]; }
+    int& baseLatency(int slot) noexcept { return baseLatencies[slot]; }
+    int baseLatency(int slot) const noexcept { return baseLatencies[slot]; }
+    double& multiplier(int slot) noexcept { return multipliers[slot]; }
+    double multiplier(int slot) const noexcept { return multipliers[slot]; }
+    int& profileIndex(int slot) noexcept { return profileIndices[slot]; }
+    int profileIndex(int slot) const noexcept { return profileIndices[slot]; }
+    unsigned char& state(int slot) noexcept { return flags[slot]; }
+    unsigned char state(int slot) const noexcept { return flags[slot]; }
+
+    //@ Calcula a latência senoidal (base * multiplicador * timeFactor, truncada) de todas as arestas de um vértice
+    //@ Percorre só os vetores de latência e multiplicador, com kernel AVX2 ou SSE2 escolhido em tempo de execução
+    //@ @param out Recebe rowEnd(i) - rowBegin(i) valores, na ordem das posições (perfis e estado não são considerados)
+    void evaluateRow(int i, double timeFactor, int* out) const noexcept;
+};
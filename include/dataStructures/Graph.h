@@ -1,6 +1,7 @@
 #pragma once
 
 #include "dataStructures/LinkedList.h"
+#include "dataStructures/NeighborLists.h"
 //@ Classe que implementa o grafo para representar os armazéns e suas conexões
 class Graph {
   private:
@@ -10,6 +11,9 @@ class Graph {
     //@ Número de armazéns no grafo
     int numWarehouses;
 
+    //@ Vizinhos de cada armazém em ordem crescente, mantidos junto com a matriz
+    NeighborLists* adjacencyLists;
+
   public:
     //@ Construtor e destrutor
     // @param numWarehouses Número de armazéns no grafo
@@ -34,4 +38,19 @@ class Graph {
     //@Função que retorna os vizinhos de um armazém específico
     //@ @param warehouseIndex Índice do armazém
     LinkedList getNeighbors(int warehouseIndex) const;
+
+    //@ Função que retorna os vizinhos de um armazém sem alocar (ordem crescente de ID)
+    //@ @param warehouseIndex Índice do armazém
+    NeighborView neighbors(int warehouseIndex) const;
+
+    //@ Função que define a ordem em que neighbors devolve os vizinhos
+    //@ Usada após a renumeração dos armazéns para manter a ordem dos IDs originais
+    //@ @param rank Chave de ordenação de cada armazém (nullptr volta à ordem por ID)
+    void setNeighborOrder(const int* rank);
+
+    //@ Função que calcula a árvore de uma BFS a partir de um armazém (vizinhos na ordem de neighbors)
+    //@ @param origin Armazém raiz
+    //@ @param parent Recebe o predecessor de cada armazém (-1 na raiz, -2 se inalcançável), com numWarehouses posições
+    //@ @param queue Vetor de trabalho com numWarehouses posições
+    void buildBfsTree(int origin, int* parent, int* queue) const;
 };
\ No newline at end of file
@@ -1,6 +1,18 @@
 #pragma once
 
+#include "ContractionHierarchy.h"
+#include "DenseDijkstra.h"
+#include "EdgeStore.h"
+#include "IndexedMinHeap.h"
 #include "LinkedList.h"
+#include "NeighborLists.h"
+#include "RoutePath.h"
+
+//@ Forward declaration
+class ThreadPool;
+
+//@ Motores de roteamento disponíveis em findBestRoute
+enum RoutingEngine { DENSE_DIJKSTRA, CONTRACTION_HIERARCHY, TIME_DEPENDENT };
 
 //@ Estrutura para armazenar informações de uma aresta
 struct EdgeInfo {
@@ -8,14 +20,24 @@ struct EdgeInfo {
     int baseLatency;
     double timeMultiplier; // Multiplicador para variação temporal
     bool isActive;
+    int profileIndex; // Perfil de latência linear por partes (-1 usa a variação senoidal)
+    bool isClosed;    // Aresta existente fechada temporariamente (isActive fica falso até a reabertura)
 
-    EdgeInfo() : capacity(0), baseLatency(0), timeMultiplier(1.0), isActive(false) {}
-    EdgeInfo(int cap, int latency, double multiplier = 1.0) : capacity(cap), baseLatency(latency), timeMultiplier(multiplier), isActive(true) {}
+    EdgeInfo() : capacity(0), baseLatency(0), timeMultiplier(1.0), isActive(false), profileIndex(-1), isClosed(false) {}
+    EdgeInfo(int cap, int latency, double multiplier = 1.0) : capacity(cap), baseLatency(latency), timeMultiplier(multiplier), isActive(true), profileIndex(-1), isClosed(false) {}
+};
+
+//@ Estrutura para um perfil de latência linear por partes, com pontos (tempo, latência) em tempos crescentes
+//@ Fora do intervalo dos pontos a latência fica constante no primeiro ou no último valor
+struct LatencyProfile {
+    int* times;
+    int* latencies;
+    int numPoints;
 };
 
 //@ Estrutura para representar uma rota completa
 struct Route {
-    LinkedList path;
+    RoutePath path;
     int totalLatency;
     int totalCapacity;
     double priority;
@@ -26,18 +48,48 @@ struct Route {
 //@ Classe que implementa o grafo estendido com múltiplas rotas e tempos variáveis
 class GraphExtended {
   private:
-    //@ Matriz de informações de arestas
-    EdgeInfo** edgeMatrix;
+    //@ Arestas em CSR com um vetor por atributo (apenas pares com aresta, abertas ou fechadas)
+    EdgeStore* edgeStore;
 
     //@ Número de armazéns no grafo
     int numWarehouses;
 
+    //@ Vizinhos de cada armazém em ordem crescente, mantidos junto com a matriz
+    NeighborLists* adjacencyLists;
+
     //@ Tempo atual da simulação para cálculos dinâmicos
     int currentTime;
 
-    //@ Cache de rotas para otimização
-    Route*** routeCache;
-    bool cacheValid;
+    //@ Número de arestas fechadas (cada aresta conta uma vez)
+    int numClosedEdges;
+
+    //@ Arestas fechadas como numClosedEdges pares consecutivos (menor, maior), mantidos por setEdgeActive
+    int* closedEdges;
+    int closedEdgesCapacity;
+
+    //@ Matriz alinhada de latências dinâmicas (NO_EDGE onde não há aresta) usada pelo kernel denso
+    int* latencyMatrix;
+    bool latencyMatrixValid;
+
+    //@ Kernel de Dijkstra denso com vetores auxiliares reutilizados entre consultas
+    DenseDijkstra* denseKernel;
+
+    //@ Latências das arestas de um armazém, usadas ao reconstruir a matriz
+    int* rowLatencies;
+
+    //@ Motor de roteamento ativo e hierarquia de contração (pertence ao grafo quando anexada)
+    RoutingEngine routingEngine;
+    ContractionHierarchy* contractionHierarchy;
+
+    //@ Perfis de latência referenciados pelas arestas
+    LatencyProfile* profiles;
+    int numProfiles;
+    int profilesCapacity;
+
+    //@ Vetores auxiliares do Dijkstra dependente do tempo (instante de chegada e predecessor)
+    int* arrivalTime;
+    int* arrivalParent;
+    IndexedMinHeap* arrivalHeap;
 
   public:
     //@ Construtor e destrutor
@@ -53,31 +105,119 @@ class GraphExtended {
     //@ Função para adicionar uma aresta com informações estendidas
     void addEdge(int i, int j, int capacity, int baseLatency, double timeMultiplier = 1.0);
 
+    //@ Reorganiza o armazenamento das arestas em CSR contíguo (chamada ao fim da carga)
+    void compactEdges();
+
     //@ Função para obter informações de uma aresta
     EdgeInfo getEdgeInfo(int i, int j) const;
 
     //@ Função para calcular latência dinâmica baseada no tempo
     int getDynamicLatency(int i, int j) const;
 
+    //@ Função que retorna a latência de uma aresta para partida no instante time
+    int getLatencyAt(int i, int j, int time) const;
+
+    //@ Latência de uma aresta ativa para partida no instante time (perfil linear por partes ou variação senoidal)
+    //@ @param profiles Perfis referenciados por edge.profileIndex
+    static int evaluateLatency(const EdgeInfo& edge, const LatencyProfile* profiles, int time);
+
+    //@ Acréscimo por peso de uma aresta no roteamento dependente do tempo: latência estática * (weightFactor - 1)
+    //@ É somado fora da latência avaliada no instante, então t + L(t) + acréscimo continua não decrescente;
+    //@ escalar L(t) pelo fator (com truncamento) quebraria FIFO mesmo em arestas validadas
+    static int weightSurcharge(int baseLatency, double timeMultiplier, double weightFactor) noexcept;
+
+    //@ Prioridade de uma rota com pathLength armazéns para um pacote de peso packageWeight no instante currentTime
+    static double routePriority(int pathLength, int packageWeight, int currentTime);
+
+    //@ Funções que expõem os perfis de latência (somente leitura) para cópias do grafo
+    const LatencyProfile* getLatencyProfiles() const noexcept;
+    int getNumLatencyProfiles() const noexcept;
+
+    //@ Define um perfil de latência linear por partes para a aresta (nos dois sentidos)
+    //@ Retorna false se a aresta não existir, os tempos não forem crescentes ou o perfil violar FIFO
+    bool setLatencyProfile(int i, int j, const int* times, const int* latencies, int numPoints);
+
+    //@ Verifica se todas as arestas respeitam FIFO (partir mais tarde nunca faz chegar mais cedo)
+    //@ Vale para qualquer peso de pacote: no modo dependente do tempo o peso entra como acréscimo fixo (weightSurcharge)
+    bool isFifo() const;
+
     //@ Função que verifica a existência de uma aresta entre dois armazéns
     bool hasEdge(int i, int j) const;
 
     //@ Função que retorna os vizinhos de um armazém específico
     LinkedList getNeighbors(int warehouseIndex) const;
 
-    //@ Função para encontrar todas as rotas possíveis entre dois armazéns
-    LinkedList findAllRoutes(int origin, int destination, int maxDepth = 10);
+    //@ Função que retorna os vizinhos de um armazém sem alocar (ordem crescente de ID)
+    //@ Índices fora do intervalo resultam em uma visão vazia
+    NeighborView neighbors(int warehouseIndex) const;
+
+    //@ Função para encontrar as maxRoutes rotas sem ciclos de menor latência entre dois armazéns
+    //@ As rotas são escritas em routes em ordem crescente de latência; retorna quantas foram encontradas
+    int findAllRoutes(int origin, int destination, Route* routes, int maxRoutes, int packageWeight = 1);
 
     //@ Função para encontrar a melhor rota considerando múltiplos fatores
     Route findBestRoute(int origin, int destination, int packageWeight = 1, int currentTime = 0);
 
-    //@ Função para invalidar cache de rotas (para roteamento dinâmico)
-    void invalidateCache();
+    //@ Função para calcular em lote as melhores rotas de vários pares, como findBestRoute faria para cada um
+    //@ Pares com mesma origem e peso compartilham uma única árvore de caminhos mínimos; grupos rodam em paralelo
+    //@ @param routes Vetor de saída com count posições (rotas inalcançáveis ficam vazias)
+    //@ @param pool Threads do cenário (ver ConfigDataExtended::pool), reaproveitadas entre chamadas
+    void findBestRoutes(const int* origins, const int* destinations, const int* weights, int count, Route* routes, int currentTime, ThreadPool& pool);
 
-  private:
-    //@ Função auxiliar para busca em profundidade de rotas
-    void dfsRoutes(int current, int destination, LinkedList& currentPath, LinkedList& allRoutes, bool* visited, int depth, int maxDepth);
+    //@ Função para encontrar a rota de chegada mais cedo partindo no instante departureTime
+    //@ Cada aresta é avaliada no instante em que o pacote chega à sua origem (Dijkstra dependente do tempo)
+    Route findEarliestArrivalRoute(int origin, int destination, int departureTime, int packageWeight = 1);
+
+    //@ Fecha ou reabre uma aresta existente (nos dois sentidos)
+    //@ A aresta fechada sai das listas de vizinhos; a matriz de latências é atualizada só nas duas posições
+    //@ @return false se a aresta não existir ou já estiver no estado pedido
+    bool setEdgeActive(int i, int j, bool active);
+
+    //@ Define a latência base de uma aresta existente (nos dois sentidos)
+    //@ @return false se a aresta não existir
+    bool setEdgeLatency(int i, int j, int baseLatency);
+
+    //@ Função que retorna o número de arestas fechadas
+    int getNumClosedEdges() const noexcept;
+
+    //@ Função que retorna as arestas fechadas como getNumClosedEdges() pares consecutivos (i, j), com i < j
+    const int* getClosedEdges() const noexcept;
+
+    //@ Anexa uma hierarquia de contração e passa a usá-la em findBestRoute (o grafo assume a posse)
+    //@ Adicionar, fechar, reabrir ou mudar a latência de arestas depois disso descarta a hierarquia e volta ao Dijkstra denso
+    void attachContractionHierarchy(ContractionHierarchy* hierarchy);
+
+    //@ Seleciona o motor de roteamento (a hierarquia de contração exige uma hierarquia anexada)
+    void setRoutingEngine(RoutingEngine engine);
 
+    //@ Função que retorna o motor de roteamento ativo
+    RoutingEngine getRoutingEngine() const noexcept;
+
+  private:
     //@ Função para calcular prioridade de uma rota
-    double calculateRoutePriority(const LinkedList& path, int packageWeight, int currentTime);
+    double calculateRoutePriority(const RoutePath& path, int packageWeight, int currentTime) const;
+
+    //@ Dijkstra dependente do tempo a partir de origin, parando ao fixar target (-1 calcula a árvore inteira)
+    //@ Os vetores de trabalho são recebidos por parâmetro para permitir buscas simultâneas
+    //@ @param rowLatency Vetor de trabalho com numWarehouses posições para as latências de cada linha
+    void runEarliestArrival(int origin, int departureTime, double weightFactor, int target, int* arrival, int* parent, IndexedMinHeap& heap, int* rowLatency) const;
+
+    //@ Latências de todas as arestas de u (abertas ou não) para partida no instante time, na ordem das posições do EdgeStore
+    void evaluateRowLatencies(int u, int time, int* out) const;
+
+    //@ Latência de um perfil linear por partes no instante time
+    static int evaluateProfile(const LatencyProfile& profile, int time);
+
+    //@ Monta o EdgeInfo de uma posição do EdgeStore
+    EdgeInfo edgeAt(int slot) const;
+
+    //@ Reconstrói a matriz de latências dinâmicas para o tempo atual
+    void rebuildLatencyMatrix();
+
+    //@ Inclui ou retira uma aresta da lista de arestas fechadas (ajustando numClosedEdges)
+    void addClosedEdge(int i, int j);
+    void removeClosedEdge(int i, int j);
+
+    //@ Reflete a mudança de uma aresta na matriz de latências e descarta a hierarquia
+    void applyEdgeChange(int i, int j);
 };
\ No newline at end of file
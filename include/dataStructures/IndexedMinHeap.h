@@ -0,0 +1,65 @@
+#pragma once
+
+//@ Classe que implementa um heap binário de vértices indexado pelo ID, com diminuição de chave
+//@ Empates de chave são desfeitos pelo menor ID, reproduzindo a ordem de extração do Dijkstra denso
+class IndexedMinHeap {
+  private:
+    //@ Vértices armazenados no heap
+    int* heapArray;
+
+    //@ Chave atual de cada vértice
+    int* keys;
+
+    //@ Posição de cada vértice no heap (-1 se ausente)
+    int* position;
+
+    //@ Capacidade máxima (número de vértices) e tamanho atual
+    int capacity;
+    int currentSize;
+
+    //@ Ordem (chave, ID) entre dois vértices
+    bool less(int a, int b) const noexcept;
+
+    //@ Funções auxiliares para manter a propriedade do heap
+    //@ @param index Índice do nó a ser ajustado
+    void heapifyUp(int index);
+    void heapifyDown(int index);
+
+    //@ Troca dois nós do heap atualizando suas posições
+    void swap(int i, int j);
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param capacity Número de vértices (IDs em [0, capacity))
+    IndexedMinHeap(int capacity);
+    ~IndexedMinHeap();
+
+    IndexedMinHeap(const IndexedMinHeap&) = delete;
+    IndexedMinHeap& operator=(const IndexedMinHeap&) = delete;
+
+    //@ Função que verifica se o heap está vazio
+    bool isEmpty() const noexcept;
+
+    //@ Função que retorna o tamanho atual do heap
+    int getCurrentSize() const noexcept;
+
+    //@ Função que verifica se um vértice está no heap
+    bool contains(int vertex) const noexcept;
+
+    //@ Insere um vértice ou diminui sua chave (chaves maiores que a atual são ignoradas)
+    //@ @param vertex ID do vértice
+    //@ @param key Nova chave
+    void pushOrDecrease(int vertex, int key);
+
+    //@ Função que retorna o vértice de menor chave sem removê-lo
+    int peekMin() const;
+
+    //@ Função que retorna a menor chave do heap
+    int peekMinKey() const;
+
+    //@ Remove e retorna o vértice de menor chave
+    int extractMin();
+
+    //@ Esvazia o heap em O(tamanho atual)
+    void clear() noexcept;
+};
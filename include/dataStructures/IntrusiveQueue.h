@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../domains/Package.h"
+
+//@ Classe que implementa uma fila de pacotes encadeada pela coluna de ganchos da PackageTable (índice do próximo pacote)
+//@ Enfileirar e desenfileirar nunca alocam, e a fila ocupa só a tabela, os índices das pontas e o tamanho
+//@ Um pacote só pode estar em uma pilha ou fila intrusiva por vez, e todos os pacotes de uma fila são da mesma tabela
+class IntrusiveQueue {
+  private:
+    //@ Tabela dos pacotes (definida no primeiro enqueue), índices do início e do fim (-1 se vazia) e tamanho atual
+    PackageTable* table;
+    int front;
+    int rear;
+    int currentSize;
+
+    //@ Função que retorna o gancho (índice do próximo pacote) de uma linha da tabela
+    std::int32_t& link(int index) const noexcept { return table->links[index]; }
+
+  public:
+    //@ Construtor e destrutor (os pacotes não pertencem à fila)
+    IntrusiveQueue() noexcept : table(nullptr), front(-1), rear(-1), currentSize(0) {}
+    ~IntrusiveQueue() = default;
+
+    IntrusiveQueue(const IntrusiveQueue&) = delete;
+    IntrusiveQueue& operator=(const IntrusiveQueue&) = delete;
+
+    //@ Mover transfere a cadeia inteira e deixa a origem vazia (só se move para filas vazias)
+    IntrusiveQueue(IntrusiveQueue&& other) noexcept : table(other.table), front(other.front), rear(other.rear), currentSize(other.currentSize) {
+        other.front = -1;
+        other.rear = -1;
+        other.currentSize = 0;
+    }
+    IntrusiveQueue& operator=(IntrusiveQueue&& other) noexcept {
+        table = other.table;
+        front = other.front;
+        rear = other.rear;
+        currentSize = other.currentSize;
+        other.front = -1;
+        other.rear = -1;
+        other.currentSize = 0;
+        return *this;
+    }
+
+    //@ Função de inserção de pacotes no fim da fila
+    void enqueue(const Package& data) noexcept {
+        table = data.table;
+        link(data.index) = -1;
+        if (rear == -1) {
+            front = data.index;
+        } else {
+            link(rear) = data.index;
+        }
+        rear = data.index;
+        currentSize++;
+    }
+
+    //@ Função de remoção do pacote do início da fila
+    Package dequeue();
+
+    //@ Função que retorna o pacote do início da fila sem removê-lo
+    Package peek() const;
+
+    //@ Remove os pacotes escolhidos por shouldRemove sem alterar a ordem dos demais (nenhuma cópia ou alocação)
+    //@ shouldRemove é chamado uma vez por pacote, do início para o fim
+    //@ @return Número de pacotes removidos
+    template <typename Predicate>
+    int removeIf(Predicate shouldRemove) {
+        int numRemoved = 0;
+        int last = -1;
+        int* slot = &front;
+        while (*slot != -1) {
+            int index = *slot;
+            if (shouldRemove(Package(*table, index))) {
+                *slot = link(index);
+                link(index) = -1;
+                numRemoved++;
+            } else {
+                last = index;
+                slot = &link(index);
+            }
+        }
+        rear = last;
+        currentSize -= numRemoved;
+        return numRemoved;
+    }
+
+    //@ Função que verifica se a fila está vazia
+    bool isEmpty() const noexcept { return front == -1; }
+
+    //@ Função que retorna o tamanho atual da fila
+    int getSize() const noexcept { return currentSize; }
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../domains/Package.h"
+
+//@ Classe que implementa uma pilha de pacotes encadeada pela coluna de ganchos da PackageTable (índice do próximo pacote)
+//@ Empilhar e desempilhar nunca alocam, e a pilha ocupa só a tabela, os índices do topo e da base e o tamanho
+//@ Um pacote só pode estar em uma pilha ou fila intrusiva por vez, e todos os pacotes de uma pilha são da mesma tabela
+//@ Também aceita inserção na base e em ordem, para as seções que não são LIFO (ver StoragePolicy)
+class IntrusiveStack {
+  private:
+    //@ Tabela dos pacotes (definida no primeiro push), índices do topo e da base (-1 se vazia) e tamanho atual
+    PackageTable* table;
+    int top;
+    int bottom;
+    int currentSize;
+
+    //@ Função que retorna o gancho (índice do próximo pacote) de uma linha da tabela
+    std::int32_t& link(int index) const noexcept { return table->links[index]; }
+
+  public:
+    //@ Construtor e destrutor (os pacotes não pertencem à pilha)
+    IntrusiveStack() noexcept : table(nullptr), top(-1), bottom(-1), currentSize(0) {}
+    ~IntrusiveStack() = default;
+
+    IntrusiveStack(const IntrusiveStack&) = delete;
+    IntrusiveStack& operator=(const IntrusiveStack&) = delete;
+
+    //@ Mover transfere a cadeia inteira (os pacotes não mudam) e deixa a origem vazia
+    //@ Um destino não vazio perde seus pacotes: só se move para pilhas vazias
+    IntrusiveStack(IntrusiveStack&& other) noexcept : table(other.table), top(other.top), bottom(other.bottom), currentSize(other.currentSize) {
+        other.top = -1;
+        other.bottom = -1;
+        other.currentSize = 0;
+    }
+    IntrusiveStack& operator=(IntrusiveStack&& other) noexcept {
+        table = other.table;
+        top = other.top;
+        bottom = other.bottom;
+        currentSize = other.currentSize;
+        other.top = -1;
+        other.bottom = -1;
+        other.currentSize = 0;
+        return *this;
+    }
+
+    //@ Função que retorna o tamanho atual da pilha
+    int getCurrentSize() const noexcept { return currentSize; }
+
+    //@ Função que verifica se a pilha está vazia
+    bool isEmpty() const noexcept { return top == -1; }
+
+    //@ Função que adiciona um pacote ao topo da pilha
+    void push(const Package& package) noexcept {
+        table = package.table;
+        link(package.index) = top;
+        if (top == -1) {
+            bottom = package.index;
+        }
+        top = package.index;
+        currentSize++;
+    }
+
+    //@ Função que adiciona um pacote na base da pilha (será o último a sair)
+    void pushBottom(const Package& package) noexcept {
+        table = package.table;
+        link(package.index) = -1;
+        if (bottom == -1) {
+            top = package.index;
+        } else {
+            link(bottom) = package.index;
+        }
+        bottom = package.index;
+        currentSize++;
+    }
+
+    //@ Função que insere um pacote mantendo a pilha ordenada por before (before(a, b): a fica acima de b)
+    //@ Empates ficam abaixo dos pacotes já guardados; chegadas em ordem custam O(1), as demais O(posição)
+    //@ @return Posição do pacote contada do topo (número de pacotes acima dele)
+    template <typename Before>
+    int insertOrdered(const Package& package, Before before) {
+        if (bottom == -1 || !before(package, Package(*package.table, bottom))) {
+            int above = currentSize;
+            pushBottom(package);
+            return above;
+        }
+        //* O pacote fica acima da base, então a busca sempre termina dentro da pilha
+        int above = 0;
+        int* slot = &top;
+        while (!before(package, Package(*table, *slot))) {
+            slot = &link(*slot);
+            above++;
+        }
+        link(package.index) = *slot;
+        *slot = package.index;
+        currentSize++;
+        return above;
+    }
+
+    //@ Função que remove e retorna o pacote do topo da pilha
+    Package pop();
+
+    //@ Função que retorna o pacote do topo da pilha sem removê-lo
+    Package peek() const;
+
+    //@ Função que remove os count pacotes do topo de uma vez
+    //@ @param out Recebe os pacotes na ordem em que pop os retornaria (out[0] é o topo)
+    void popTop(int count, Package* out);
+
+    //@ Função que empilha count pacotes de uma vez, desfazendo um popTop com o mesmo vetor
+    //@ (packages[count - 1] é empilhado primeiro e packages[0] fica no topo)
+    void pushRange(const Package* packages, int count) noexcept;
+
+    //@ Remove os pacotes escolhidos por shouldRemove sem alterar a ordem dos demais (nenhuma cópia ou alocação)
+    //@ shouldRemove é chamado uma vez por pacote, do topo para a base
+    //@ @return Número de pacotes removidos
+    template <typename Predicate>
+    int removeIf(Predicate shouldRemove) {
+        int numRemoved = 0;
+        int last = -1;
+        int* slot = &top;
+        while (*slot != -1) {
+            int index = *slot;
+            if (shouldRemove(Package(*table, index))) {
+                *slot = link(index);
+                link(index) = -1;
+                numRemoved++;
+            } else {
+                last = index;
+                slot = &link(index);
+            }
+        }
+        bottom = last;
+        currentSize -= numRemoved;
+        return numRemoved;
+    }
+};
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "GraphExtended.h"
+#include "IndexedMinHeap.h"
+
+//@ Classe que enumera, sob demanda, as rotas sem ciclos de menor latência entre dois armazéns (algoritmo de Yen)
+//@ A árvore reversa de caminhos mínimos até o destino é calculada uma vez e reaproveitada como heurística
+//@ do A* nos desvios e como o próprio desvio quando ele não cruza nada bloqueado
+class KShortestPaths {
+  private:
+    //@ Estrutura que guarda um caminho com seu custo
+    struct StoredPath {
+        int* nodes;
+        int length;
+        int cost;
+    };
+
+    //@ Origem, destino e número de vértices do grafo
+    int numVertices;
+    int origin;
+    int destination;
+
+    //@ Cópia em CSR dos custos das arestas (latência dinâmica × fator de peso)
+    int* offsets;
+    int* targets;
+    int* costs;
+
+    //@ Árvore reversa: distância até o destino e próximo salto em direção a ele
+    int* distToDestination;
+    int* nextHop;
+
+    //@ Rotas já entregues (A) e candidatas ainda não escolhidas (B)
+    StoredPath* accepted;
+    int numAccepted;
+    int acceptedCapacity;
+    StoredPath* candidates;
+    int numCandidates;
+    int candidatesCapacity;
+
+    //@ Vetores auxiliares do A* dos desvios
+    int* gScore;
+    int* parent;
+    int* touched;
+    int numTouched;
+    IndexedMinHeap* openSet;
+    char* blockedVertex;
+    char* blockedNext;
+
+    //@ Buffer do caminho em montagem
+    int* pathBuffer;
+
+    //@ Indica que não há mais rotas
+    bool exhausted;
+
+    //@ Custo da aresta (u, v) no snapshot (INT_MAX se não existir)
+    int edgeCost(int u, int v) const noexcept;
+
+    //@ Gera as candidatas derivadas da última rota aceita
+    void generateSpurCandidates();
+
+    //@ Busca o desvio de spur até o destino respeitando os bloqueios; retorna seu custo (INT_MAX se não houver)
+    //@ O desvio é escrito em pathBuffer a partir de offset; spurLength recebe o número de vértices
+    int findSpurPath(int spur, int offset, int& spurLength);
+
+    //@ Verifica se um caminho já está entre as aceitas ou candidatas
+    bool isKnownPath(const int* nodes, int length) const;
+
+    //@ Acrescenta um caminho a uma das listas, copiando os vértices
+    static void appendPath(StoredPath*& list, int& size, int& capacity, const int* nodes, int length, int cost);
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param graph Grafo de onde os custos são copiados (no tempo atual do grafo)
+    //@ @param packageWeight Peso do pacote, aplicado como em findBestRoute
+    KShortestPaths(const GraphExtended& graph, int origin, int destination, int packageWeight = 1);
+    ~KShortestPaths();
+
+    KShortestPaths(const KShortestPaths&) = delete;
+    KShortestPaths& operator=(const KShortestPaths&) = delete;
+
+    //@ Calcula a próxima rota em ordem crescente de latência; retorna false se não houver mais
+    bool nextRoute(Route& route);
+
+    //@ Função que retorna quantas rotas já foram entregues
+    int getNumRoutesFound() const noexcept;
+};
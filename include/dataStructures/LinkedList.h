@@ -1,23 +1,34 @@
 #pragma once
 
+#include <memory>
 #include <stdexcept>
 
+#include "../utils/SlabAllocator.h"
+
 //@ Classe que implementa uma lista ligada genérica, para rota ótima e lista de
 //@ pilhas
-class LinkedList {
+//@ Os nós são obtidos do alocador (std::allocator por padrão; alocadores de arena ou de pool
+//@ podem ser usados no lugar, desde que sigam a interface de std::allocator_traits)
+template <typename T, typename Allocator = std::allocator<T>>
+class BasicLinkedList {
   private:
     //@ Struct que define um nó da lista ligada
     struct Node {
         //@ Data armazenado no nó
-        int data;
+        T data;
 
         //@ Ponteiro para o próximo nó na lista
         Node* next;
 
         //@ Construtor do nó que inicializa o dado e o ponteiro para o próximo nó
-        Node(int data) : data(data), next(nullptr) {}
+        Node(const T& data) : data(data), next(nullptr) {}
     };
 
+    //@ Alocador de nós (o alocador recebido, reassociado ao tipo Node)
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Node> NodeAllocator;
+    typedef std::allocator_traits<NodeAllocator> NodeTraits;
+    NodeAllocator allocator;
+
     //@ Ponteiro para o início e fim da lista
     Node* head;
     Node* tail;
@@ -25,42 +36,198 @@ class LinkedList {
     //@ Atributo que guarda o tamanho atual da lista
     int currentSize;
 
+    //@ Cria e destrói um nó com o alocador da lista
+    Node* createNode(const T& data);
+    void destroyNode(Node* node) noexcept;
+
   public:
     //@ Construtor
-    LinkedList();
+    //@ @param allocator Alocador dos nós
+    explicit BasicLinkedList(const Allocator& allocator = Allocator());
 
     //@ Construtor de cópia
-    LinkedList(const LinkedList& other);
+    BasicLinkedList(const BasicLinkedList& other);
 
     //@ Destrutor
-    ~LinkedList();
+    ~BasicLinkedList();
 
     //@ Sobrecarga do operador de atribuição
-    LinkedList& operator=(const LinkedList& other);
+    BasicLinkedList& operator=(const BasicLinkedList& other);
 
     //@ Função que retorna o tamanho atual da lista
-    int getCurrentSize() const noexcept;
+    int getCurrentSize() const noexcept { return currentSize; }
 
     //@ Função que retorna um booleano indicando se a lista está vazia
-    bool isEmpty() const noexcept;
+    bool isEmpty() const noexcept { return head == nullptr; }
 
     //@ Função que adiciona um novo nó ao final da lista
-    void addBack(int data);
+    void addBack(const T& data);
 
     //@ Função que adiciona um novo nó ao início da lista
-    void addFront(int data);
+    void addFront(const T& data);
 
     //@ Função que remove o primeiro nó da lista
     void removeFront();
 
     //@ Função que retorna o dado do primeiro nó sem removê-lo
-    int peekFront() const;
+    const T& peekFront() const;
 
     //@ Função que retorna um dado em uma posição específica da lista
-    int getDataAt(int position) const;
+    const T& getDataAt(int position) const;
 
     //@ Função que copia os dados de outra lista ligada
-    void copy(const LinkedList& other);
-
-    void removeBack(); 
-};
\ No newline at end of file
+    void copy(const BasicLinkedList& other);
+
+    //@ Função que remove o último nó da lista (O(n))
+    void removeBack();
+};
+
+//@ Lista de inteiros usada pelos grafos (vizinhos de um armazém), com os nós no pool do seu tipo
+typedef BasicLinkedList<int, SlabAllocator<int>> LinkedList;
+
+//@ Instanciada em LinkedList.cpp
+extern template class BasicLinkedList<int, SlabAllocator<int>>;
+
+// --- Implementação ---
+
+template <typename T, typename Allocator>
+BasicLinkedList<T, Allocator>::BasicLinkedList(const Allocator& allocator)
+    : allocator(allocator), head(nullptr), tail(nullptr), currentSize(0) {}
+
+template <typename T, typename Allocator>
+BasicLinkedList<T, Allocator>::BasicLinkedList(const BasicLinkedList& other)
+    : allocator(NodeTraits::select_on_container_copy_construction(other.allocator)), head(nullptr), tail(nullptr), currentSize(0) {
+    copy(other);
+}
+
+template <typename T, typename Allocator>
+BasicLinkedList<T, Allocator>::~BasicLinkedList() {
+    while (!isEmpty()) {
+        removeFront();
+    }
+}
+
+template <typename T, typename Allocator>
+BasicLinkedList<T, Allocator>& BasicLinkedList<T, Allocator>::operator=(const BasicLinkedList& other) {
+    copy(other);
+    return *this;
+}
+
+template <typename T, typename Allocator>
+typename BasicLinkedList<T, Allocator>::Node* BasicLinkedList<T, Allocator>::createNode(const T& data) {
+    Node* node = NodeTraits::allocate(allocator, 1);
+    try {
+        NodeTraits::construct(allocator, node, data);
+    } catch (...) {
+        NodeTraits::deallocate(allocator, node, 1);
+        throw;
+    }
+    return node;
+}
+
+template <typename T, typename Allocator>
+void BasicLinkedList<T, Allocator>::destroyNode(Node* node) noexcept {
+    NodeTraits::destroy(allocator, node);
+    NodeTraits::deallocate(allocator, node, 1);
+}
+
+template <typename T, typename Allocator>
+void BasicLinkedList<T, Allocator>::addBack(const T& data) {
+    Node* newNode = createNode(data);
+
+    if (isEmpty()) {
+        head = newNode;
+        tail = newNode;
+    } else {
+        tail->next = newNode;
+        tail = newNode;
+    }
+    currentSize++;
+}
+
+template <typename T, typename Allocator>
+void BasicLinkedList<T, Allocator>::addFront(const T& data) {
+    Node* newNode = createNode(data);
+
+    if (isEmpty()) {
+        head = newNode;
+        tail = newNode;
+    } else {
+        newNode->next = head;
+        head = newNode;
+    }
+    currentSize++;
+}
+
+template <typename T, typename Allocator>
+void BasicLinkedList<T, Allocator>::removeFront() {
+    if (isEmpty()) {
+        return;
+    }
+
+    Node* nodeToDelete = head;
+    head = head->next;
+    destroyNode(nodeToDelete);
+    currentSize--;
+
+    if (isEmpty()) {
+        tail = nullptr;
+    }
+}
+
+template <typename T, typename Allocator>
+const T& BasicLinkedList<T, Allocator>::peekFront() const {
+    if (isEmpty()) {
+        throw std::out_of_range("Nao e possivel espiar uma lista vazia.");
+    }
+    return head->data;
+}
+
+template <typename T, typename Allocator>
+const T& BasicLinkedList<T, Allocator>::getDataAt(int position) const {
+    if (position < 0 || position >= currentSize) {
+        throw std::out_of_range("Posição fora da lista.");
+    }
+    Node* current = head;
+    for (int i = 0; i < position; ++i) {
+        current = current->next;
+    }
+    return current->data;
+}
+
+template <typename T, typename Allocator>
+void BasicLinkedList<T, Allocator>::copy(const BasicLinkedList& other) {
+    if (this == &other) {
+        return;
+    }
+
+    while (!isEmpty()) {
+        removeFront();
+    }
+
+    for (Node* current = other.head; current != nullptr; current = current->next) {
+        addBack(current->data);
+    }
+}
+
+template <typename T, typename Allocator>
+void BasicLinkedList<T, Allocator>::removeBack() {
+    if (isEmpty()) {
+        return;
+    }
+
+    if (head == tail) {
+        destroyNode(head);
+        head = nullptr;
+        tail = nullptr;
+    } else {
+        Node* current = head;
+        while (current->next != tail) {
+            current = current->next;
+        }
+        destroyNode(tail);
+        tail = current;
+        tail->next = nullptr;
+    }
+    currentSize--;
+}
@@ -1,12 +1,24 @@
 #pragma once
 
+#include <memory>
+#include <stdexcept>
+
 #include "core/Event.h"
 
-//@ Classe de implementação de um MinHeap para o escalonador de eventos de maior prioridade
-class MinHeap {
+//@ Classe de implementação de um MinHeap genérico de capacidade fixa
+//@ Compare é um objeto função (a < b); como faz parte do tipo, a comparação é expandida em linha nos laços
+//@ de heapifyUp/heapifyDown, sem chamada indireta. O vetor é obtido do alocador (std::allocator por padrão)
+template <typename T, typename Compare, typename Allocator = std::allocator<T>>
+class BasicMinHeap {
   private:
-    //@ Array de ponteiros para Events
-    Event** heapArray;
+    typedef std::allocator_traits<Allocator> Traits;
+
+    //@ Alocador do vetor e comparação
+    Allocator allocator;
+    Compare less;
+
+    //@ Vetor de elementos
+    T* heapArray;
 
     //@ Capacidade máxima do heap e tamanho atual
     int capacity;
@@ -19,40 +31,157 @@ class MinHeap {
 
     //@ Funções auxiliares para acessar os índices dos nós pai e filhos
     //@ @param index Índice do nó
-    int parent(int index) const noexcept;
-    int leftChild(int index) const noexcept;
-    int rightChild(int index) const noexcept;
-
-    //@ Função auxiliar para trocar dois eventos no heap
-    //@ @param a Primeiro evento a ser trocado
-    //@ @param b Segundo evento a ser trocado
-    void swap(Event*& a, Event*& b);
+    static int parent(int index) noexcept { return (index - 1) / 2; }
+    static int leftChild(int index) noexcept { return 2 * index + 1; }
+    static int rightChild(int index) noexcept { return 2 * index + 2; }
 
   public:
     //@ Construtor e destrutor
     //@ @param capacity Capacidade máxima do heap
-    MinHeap(int capacity);
-    ~MinHeap();
+    //@ @param less Comparação entre elementos
+    //@ @param allocator Alocador do vetor
+    explicit BasicMinHeap(int capacity, const Compare& less = Compare(), const Allocator& allocator = Allocator());
+    ~BasicMinHeap();
+
+    BasicMinHeap(const BasicMinHeap&) = delete;
+    BasicMinHeap& operator=(const BasicMinHeap&) = delete;
 
-    //@ Função de inserção de eventos no heap
-    //@ @param event Ponteiro para o evento a ser inserido
-    void insert(Event* event);
+    //@ Função de inserção de elementos no heap
+    //@ @param value Elemento a ser inserido
+    void insert(const T& value);
 
-    //@ Função de extração do menor evento do heap
-    Event* extractMin();
+    //@ Função de extração do menor elemento do heap
+    T extractMin();
 
     //@ Função que retorna o tamanho atual do heap
-    int getCurrentSize() const noexcept;
+    int getCurrentSize() const noexcept { return currentSize; }
+
+    //@ Função para espiar o menor elemento do heap sem removê-lo
+    const T& peekMin() const;
+
+    //@ Função que retorna o maior elemento do heap (O(n))
+    const T& peekMax() const;
+
+    //@ Função que retorna um booleno indicando se o heap está vazio
+    bool isEmpty() const noexcept { return currentSize == 0; }
+
+    //@ Função que retorna o elemento na posição index do vetor do heap (sem ordem definida, para depuração)
+    const T& at(int index) const noexcept { return heapArray[index]; }
+};
+
+//@ Ordem dos eventos do escalonador (compara os eventos apontados)
+struct EventPointerLess {
+    bool operator()(const Event* a, const Event* b) const noexcept { return *a < *b; }
+};
+
+//@ MinHeap de eventos usado pelos escalonadores
+typedef BasicMinHeap<Event*, EventPointerLess> MinHeap;
+
+//@ Instanciado em MinHeap.cpp
+extern template class BasicMinHeap<Event*, EventPointerLess>;
+
+//@ Função que imprime um heap de eventos (para debug)
+void printHeap(const MinHeap& heap);
+
+// --- Implementação ---
+
+template <typename T, typename Compare, typename Allocator>
+BasicMinHeap<T, Compare, Allocator>::BasicMinHeap(int capacity, const Compare& less, const Allocator& allocator)
+    : allocator(allocator), less(less), heapArray(nullptr), capacity(capacity), currentSize(0) {
+    if (capacity <= 0) {
+        throw std::invalid_argument("A capacidade do Heap deve ser um número positivo.");
+    }
+    heapArray = Traits::allocate(this->allocator, capacity);
+}
+
+template <typename T, typename Compare, typename Allocator>
+BasicMinHeap<T, Compare, Allocator>::~BasicMinHeap() {
+    for (int i = 0; i < currentSize; ++i) {
+        Traits::destroy(allocator, heapArray + i);
+    }
+    Traits::deallocate(allocator, heapArray, capacity);
+}
+
+template <typename T, typename Compare, typename Allocator>
+void BasicMinHeap<T, Compare, Allocator>::insert(const T& value) {
+    if (currentSize >= capacity) {
+        throw std::overflow_error("O Heap está cheio. Não é possível inserir.");
+    }
+
+    Traits::construct(allocator, heapArray + currentSize, value);
+    currentSize++;
+    heapifyUp(currentSize - 1);
+}
+
+template <typename T, typename Compare, typename Allocator>
+T BasicMinHeap<T, Compare, Allocator>::extractMin() {
+    if (isEmpty()) {
+        throw std::out_of_range("O Heap está vazio.");
+    }
+
+    T minValue = heapArray[0];
+    currentSize--;
+    heapArray[0] = heapArray[currentSize];
+    Traits::destroy(allocator, heapArray + currentSize);
+
+    if (!isEmpty()) {
+        heapifyDown(0);
+    }
+
+    return minValue;
+}
+
+template <typename T, typename Compare, typename Allocator>
+const T& BasicMinHeap<T, Compare, Allocator>::peekMin() const {
+    if (isEmpty()) {
+        throw std::out_of_range("O Heap está vazio.");
+    }
+    return heapArray[0];
+}
 
-    //@ Função para espiar o menor evento do heap sem removê-lo
-    Event* peekMin() const;
+template <typename T, typename Compare, typename Allocator>
+const T& BasicMinHeap<T, Compare, Allocator>::peekMax() const {
+    if (isEmpty()) {
+        throw std::out_of_range("O Heap está vazio.");
+    }
 
-  
-    Event* peekMax() const;
+    int maxIndex = 0;
+    for (int i = 1; i < currentSize; ++i) {
+        if (less(heapArray[maxIndex], heapArray[i])) {
+            maxIndex = i;
+        }
+    }
+    return heapArray[maxIndex];
+}
 
-    //@ Função que retorna um booleno indicando se o heap está cheio
-    bool isEmpty() const noexcept;
+template <typename T, typename Compare, typename Allocator>
+void BasicMinHeap<T, Compare, Allocator>::heapifyUp(int index) {
+    // O elemento sobe deslocando os pais para baixo e é gravado uma única vez no fim
+    T value = heapArray[index];
+    while (index > 0 && less(value, heapArray[parent(index)])) {
+        heapArray[index] = heapArray[parent(index)];
+        index = parent(index);
+    }
+    heapArray[index] = value;
+}
 
-    //@ Função que imprime o heap (para debug)
-    void printHeap() const;;
-};
\ No newline at end of file
+template <typename T, typename Compare, typename Allocator>
+void BasicMinHeap<T, Compare, Allocator>::heapifyDown(int index) {
+    T value = heapArray[index];
+    while (true) {
+        int smallest = leftChild(index);
+        if (smallest >= currentSize) {
+            break;
+        }
+        int right = rightChild(index);
+        if (right < currentSize && less(heapArray[right], heapArray[smallest])) {
+            smallest = right;
+        }
+        if (!less(heapArray[smallest], value)) {
+            break;
+        }
+        heapArray[index] = heapArray[smallest];
+        index = smallest;
+    }
+    heapArray[index] = value;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+//@ Estrutura que expõe, sem cópia nem alocação, os vizinhos de um armazém em ordem crescente de ID
+//@ (ou na ordem definida por NeighborLists::setOrder)
+//@ Aponta para a lista de adjacência interna do grafo: fica inválida se o grafo ganhar ou perder arestas
+//@ Uso: for (int neighbor : graph.neighbors(u)) { ... }
+struct NeighborView {
+    const int* first;
+    const int* last;
+
+    NeighborView() : first(nullptr), last(nullptr) {}
+    NeighborView(const int* first, const int* last) : first(first), last(last) {}
+
+    const int* begin() const noexcept { return first; }
+    const int* end() const noexcept { return last; }
+
+    //@ Função que retorna o número de vizinhos
+    int size() const noexcept { return static_cast<int>(last - first); }
+
+    //@ Função que retorna um booleano indicando se não há vizinhos
+    bool isEmpty() const noexcept { return first == last; }
+
+    //@ Função que retorna o vizinho na posição index
+    int operator[](int index) const noexcept { return first[index]; }
+};
+
+//@ Classe que mantém, ao lado da matriz de adjacência, uma lista ordenada de vizinhos por vértice
+//@ Percorrer os vizinhos custa O(grau) em vez de O(número de vértices)
+class NeighborLists {
+  private:
+    //@ Vizinhos de cada vértice (ordenados), quantidade e capacidade de cada linha
+    int** rows;
+    int* degrees;
+    int* capacities;
+
+    //@ Número de vértices
+    int numVertices;
+
+    //@ Chave de ordenação dos vizinhos (nullptr ordena pelo próprio ID)
+    int* rank;
+
+    //@ Chave de ordenação de um vértice
+    int keyOf(int vertex) const noexcept { return rank ? rank[vertex] : vertex; }
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param numVertices Número de vértices (sem arestas inicialmente)
+    NeighborLists(int numVertices);
+    ~NeighborLists();
+
+    NeighborLists(const NeighborLists&) = delete;
+    NeighborLists& operator=(const NeighborLists&) = delete;
+
+    //@ Insere j entre os vizinhos de i mantendo a ordem (não faz nada se já estiver)
+    void insert(int i, int j);
+
+    //@ Remove j dos vizinhos de i (não faz nada se não estiver)
+    void remove(int i, int j);
+
+    //@ Define a chave pela qual os vizinhos são ordenados e reordena as listas existentes
+    //@ @param order Chave de cada vértice (copiada); nullptr volta a ordenar pelo ID
+    void setOrder(const int* order);
+
+    //@ Função que retorna a visão dos vizinhos de i
+    NeighborView view(int i) const noexcept { return NeighborView(rows[i], rows[i] + degrees[i]); }
+};
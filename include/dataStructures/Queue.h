@@ -1,46 +1,145 @@
 #pragma once
 
+#include <memory>
+#include <stdexcept>
+
 #include "../domains/Package.h"
 
-//@ Classe que implementa uma fila de pacotes usando uma lista encadeada
-class Queue {
+//@ Classe que implementa uma fila genérica (por padrão, de pacotes) usando um buffer circular
+//@ A capacidade é sempre potência de dois (o índice circular é só uma máscara) e só cresce:
+//@ depois de atingir o tamanho de trabalho, enfileirar e desenfileirar não alocam
+//@ Uma fila que nunca recebeu elementos não aloca nada; o buffer é obtido do alocador (std::allocator por padrão)
+template <typename T, typename Allocator = std::allocator<T>>
+class BasicQueue {
 private:
-    //@ Estrutura interna que representa um nó na fila
-    struct Node {
-        Package* data; 
-        Node* next;    
+    typedef std::allocator_traits<Allocator> Traits;
+
+    //@ Alocador do buffer
+    Allocator allocator;
+
+    //@ Buffer circular, sua capacidade (0 ou potência de dois), início e tamanho atual
+    T* buffer;
+    int capacity;
+    int front;
+    int currentSize;
 
-        Node(Package* dataValue);
-    };
+    //@ Dobra a capacidade, desenrolando os elementos para o início do novo buffer
+    void grow();
 
-    //@ Ponteiros para o início e fim da fila, e o tamanho atual
-    Node* front; 
-    Node* rear; 
-    int currentSize; 
+    //@ Posição no buffer do elemento index da fila
+    int slot(int index) const noexcept { return (front + index) & (capacity - 1); }
 
 public:
-    
+
     //@ Construtor e destrutor
-    Queue();
-    ~Queue();
+    //@ @param allocator Alocador do buffer
+    explicit BasicQueue(const Allocator& allocator = Allocator());
+    ~BasicQueue();
+
+    BasicQueue(const BasicQueue&) = delete;
+    BasicQueue& operator=(const BasicQueue&) = delete;
 
-    //@ Função de inserção de pacotes na fila
-    //@ @param data Ponteiro para o pacote a ser inserido
-    void enqueue(Package* data);
+    //@ Função de inserção de elementos na fila
+    //@ @param data Elemento a ser inserido
+    void enqueue(const T& data) {
+        if (currentSize == capacity) {
+            grow();
+        }
+        // O fim da fila fica currentSize posições depois do início, dando a volta no buffer.
+        Traits::construct(allocator, buffer + slot(currentSize), data);
+        currentSize++;
+    }
 
-    //@ Função de remoção de pacotes da fila
-    //@ @return Ponteiro para o pacote removido
-    Package* dequeue();
+    //@ Função de remoção de elementos da fila
+    //@ @return Elemento removido
+    T dequeue();
 
-    //@ Função que retorna o pacote do início da fila sem removê-lo
-    //@ @return Ponteiro para o pacote no início da fila
-    Package* peek() const;
+    //@ Função que retorna o elemento do início da fila sem removê-lo
+    //@ @return Elemento no início da fila
+    const T& peek() const;
+
+    //@ Função que retorna o elemento na posição index da fila (0 é o início), em O(1)
+    //@ @return Elemento, ou T() (nullptr para ponteiros) se o índice for inválido
+    T peek(int index) const;
 
     //@ Função que verifica se a fila está vazia
     //@ @return true se a fila estiver vazia, false caso contrário
-    bool isEmpty() const;
+    bool isEmpty() const noexcept { return currentSize == 0; }
 
     //@ Função que retorna o tamanho atual da fila
     //@ @return Tamanho da fila
-    int getSize() const;
-};
\ No newline at end of file
+    int getSize() const noexcept { return currentSize; }
+};
+
+//@ Fila de pacotes
+typedef BasicQueue<Package*> Queue;
+
+//@ Instanciada em Queue.cpp
+extern template class BasicQueue<Package*>;
+
+// --- Implementação ---
+
+template <typename T, typename Allocator>
+BasicQueue<T, Allocator>::BasicQueue(const Allocator& allocator) : allocator(allocator), buffer(nullptr), capacity(0), front(0), currentSize(0) {}
+
+template <typename T, typename Allocator>
+BasicQueue<T, Allocator>::~BasicQueue() {
+    // Os elementos apontados não pertencem à fila: só o buffer é liberado.
+    for (int i = 0; i < currentSize; ++i) {
+        Traits::destroy(allocator, buffer + slot(i));
+    }
+    if (buffer != nullptr) {
+        Traits::deallocate(allocator, buffer, capacity);
+    }
+}
+
+template <typename T, typename Allocator>
+T BasicQueue<T, Allocator>::dequeue() {
+    if (isEmpty()) {
+        throw std::out_of_range("A Fila está vazia. Não é possível remover.");
+    }
+
+    T data = buffer[front];
+    Traits::destroy(allocator, buffer + front);
+    front = slot(1);
+    currentSize--;
+
+    // Fila vazia volta ao início do buffer, mantendo os próximos elementos contíguos.
+    if (currentSize == 0) {
+        front = 0;
+    }
+
+    return data;
+}
+
+template <typename T, typename Allocator>
+void BasicQueue<T, Allocator>::grow() {
+    int newCapacity = capacity == 0 ? 8 : capacity * 2;
+    T* newBuffer = Traits::allocate(allocator, newCapacity);
+    for (int i = 0; i < currentSize; ++i) {
+        Traits::construct(allocator, newBuffer + i, buffer[slot(i)]);
+        Traits::destroy(allocator, buffer + slot(i));
+    }
+    if (buffer != nullptr) {
+        Traits::deallocate(allocator, buffer, capacity);
+    }
+    buffer = newBuffer;
+    capacity = newCapacity;
+    front = 0;
+}
+
+template <typename T, typename Allocator>
+const T& BasicQueue<T, Allocator>::peek() const {
+    if (isEmpty()) {
+        throw std::out_of_range("A Fila está vazia.");
+    }
+    return buffer[front];
+}
+
+template <typename T, typename Allocator>
+T BasicQueue<T, Allocator>::peek(int index) const {
+    if (index < 0 || index >= currentSize) {
+        return T();
+    }
+    return buffer[slot(index)];
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "RoutePath.h"
+#include <mutex>
+
+//@ Classe que guarda, em um único vetor contíguo, as rotas internadas (imutáveis e sem duplicatas)
+//@ Cada rota é identificada por um ID; pacotes com o mesmo caminho compartilham o mesmo ID
+//@ O ID 0 é sempre a rota vazia
+//@ Cada cenário carregado tem a sua (ConfigData::routes), liberada junto com ele
+//@ Internar pode realocar os vetores: várias threads podem internar ao mesmo tempo, mas nenhuma leitura pode correr junto
+class RouteArena {
+  private:
+    //@ Vértices de todas as rotas, concatenados
+    int* nodes;
+    int numNodes;
+    int nodesCapacity;
+
+    //@ Início, tamanho e hash de cada rota
+    int* offsets;
+    int* lengths;
+    unsigned int* hashes;
+    int numPaths;
+    int pathsCapacity;
+
+    //@ Tabela de espalhamento (endereçamento aberto) de hash de conteúdo -> ID da rota (-1 se vazio)
+    int* buckets;
+    int numBuckets;
+
+    //@ Protege a internação quando feita por várias threads (as leituras não são sincronizadas, ver acima)
+    std::mutex mutex;
+
+    //@ Hash FNV-1a dos vértices de um caminho
+    static unsigned int hashPath(const int* path, int length) noexcept;
+
+    //@ Verifica se a rota pathId tem exatamente os vértices dados
+    bool equals(int pathId, const int* path, int length) const noexcept;
+
+    //@ Dobra a tabela de espalhamento e reinsere as rotas
+    void growBuckets();
+
+  public:
+    //@ Construtor e destrutor
+    RouteArena();
+    ~RouteArena();
+
+    RouteArena(const RouteArena&) = delete;
+    RouteArena& operator=(const RouteArena&) = delete;
+
+    //@ Interna um caminho e retorna seu ID (o mesmo ID para caminhos iguais)
+    //@ @param path Vértices do caminho
+    //@ @param length Número de vértices
+    int intern(const int* path, int length);
+
+    //@ Interna o caminho guardado em uma RoutePath
+    int intern(const RoutePath& route);
+
+    //@ Função que retorna o número de vértices da rota
+    int getLength(int pathId) const;
+
+    //@ Função que retorna o vértice na posição hop da rota
+    int getNode(int pathId, int hop) const;
+
+    //@ Função que retorna os vértices da rota (válido até a próxima internação)
+    const int* getNodes(int pathId) const;
+
+    //@ Função que copia a rota a partir da posição fromHop
+    RoutePath toPath(int pathId, int fromHop = 0) const;
+
+    //@ Funções que retornam o número de rotas distintas e de vértices armazenados
+    int getNumPaths() const noexcept;
+    int getNumNodes() const noexcept;
+};
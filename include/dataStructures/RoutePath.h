@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stdexcept>
+
+//@ Classe que guarda uma rota (sequência de IDs de armazéns) em memória contígua
+//@ Rotas de até INLINE_CAPACITY armazéns ficam no próprio objeto, sem alocação; rotas maiores vão para o heap
+//@ Os elementos ocupam data[head, head + size): remover do início só avança head, e inserir no início
+//@ reaproveita a folga antes de head (a reconstrução de um caminho pelos predecessores não desloca nada)
+//@ Mantém a interface de LinkedList usada pelas rotas (addBack, addFront, removeFront, peekFront, ...)
+class RoutePath {
+  public:
+    //@ Número de armazéns guardados sem alocação
+    static constexpr int INLINE_CAPACITY = 16;
+
+  private:
+    //@ Vetor em uso (inlineData ou heap), sua capacidade, início e número de elementos
+    int* data;
+    int capacity;
+    int head;
+    int size;
+
+    //@ Armazenamento interno para rotas curtas
+    int inlineData[INLINE_CAPACITY];
+
+    //@ Função que indica se os elementos estão no armazenamento interno
+    bool isInline() const noexcept { return data == inlineData; }
+
+    //@ Abre espaço para mais um elemento no início (atFront) ou no fim, dobrando a capacidade se preciso
+    //@ Os elementos ficam encostados no lado oposto ao da inserção
+    void makeRoom(bool atFront);
+
+    //@ Libera o heap (se usado) e volta ao armazenamento interno vazio
+    void release() noexcept;
+
+  public:
+    //@ Construtor (rota vazia, sem alocação)
+    RoutePath() noexcept : data(inlineData), capacity(INLINE_CAPACITY), head(0), size(0) {}
+
+    //@ Construtor a partir de length armazéns
+    RoutePath(const int* nodes, int length);
+
+    //@ Construtores de cópia e de movimentação (mover uma rota no heap só transfere o ponteiro)
+    RoutePath(const RoutePath& other);
+    RoutePath(RoutePath&& other) noexcept;
+
+    //@ Destrutor
+    ~RoutePath();
+
+    //@ Sobrecarga dos operadores de atribuição
+    RoutePath& operator=(const RoutePath& other);
+    RoutePath& operator=(RoutePath&& other) noexcept;
+
+    //@ Função que retorna o tamanho atual da rota
+    int getCurrentSize() const noexcept { return size; }
+
+    //@ Função que retorna um booleano indicando se a rota está vazia
+    bool isEmpty() const noexcept { return size == 0; }
+
+    //@ Função que adiciona um armazém ao final da rota
+    void addBack(int value) {
+        if (head + size == capacity) {
+            makeRoom(false);
+        }
+        data[head + size++] = value;
+    }
+
+    //@ Função que adiciona um armazém ao início da rota
+    void addFront(int value) {
+        if (head == 0) {
+            makeRoom(true);
+        }
+        data[--head] = value;
+        size++;
+    }
+
+    //@ Função que remove o primeiro armazém da rota (O(1); não faz nada se estiver vazia)
+    void removeFront() noexcept {
+        if (size > 0) {
+            head++;
+            size--;
+        }
+    }
+
+    //@ Função que remove o último armazém da rota (não faz nada se estiver vazia)
+    void removeBack() noexcept {
+        if (size > 0) {
+            size--;
+        }
+    }
+
+    //@ Função que retorna o primeiro armazém sem removê-lo
+    int peekFront() const {
+        if (size == 0) {
+            throw std::out_of_range("Nao e possivel espiar uma lista vazia.");
+        }
+        return data[head];
+    }
+
+    //@ Função que retorna o armazém em uma posição específica da rota (O(1))
+    int getDataAt(int position) const {
+        if (position < 0 || position >= size) {
+            throw std::out_of_range("Posição fora da rota.");
+        }
+        return data[head + position];
+    }
+
+    //@ Acesso sem verificação ao armazém na posição index
+    int operator[](int index) const noexcept { return data[head + index]; }
+
+    //@ Função que remove todos os armazéns (mantém a capacidade)
+    void clear() noexcept {
+        head = 0;
+        size = 0;
+    }
+
+    //@ Função que copia os armazéns de outra rota
+    void copy(const RoutePath& other);
+
+    //@ Funções que expõem os armazéns em sequência (for (int node : path) { ... })
+    const int* begin() const noexcept { return data + head; }
+    const int* end() const noexcept { return data + head + size; }
+};
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "GraphExtended.h"
+#include "IndexedMinHeap.h"
+
+class ThreadPool;
+
+//@ Classe que responde consultas de rota em paralelo sobre uma cópia imutável da topologia de um GraphExtended
+//@ O instante de cada consulta é explícito (nada depende do currentTime do grafo), e cada trabalhador tem seus
+//@ próprios vetores de busca e sua fatia de cache: chamadas com workerIds distintos podem rodar simultaneamente
+//@ As rotas são as mesmas do Dijkstra denso de findBestRoute (ou do Dijkstra dependente do tempo, se for o motor do grafo)
+class RouteService {
+  private:
+    //@ Entrada da fatia de cache de um trabalhador (mapeamento direto por hash da consulta)
+    struct CacheEntry {
+        int origin;
+        int destination;
+        int weight;
+        int time;
+        bool valid;
+        Route route;
+
+        CacheEntry() : origin(-1), destination(-1), weight(0), time(0), valid(false) {}
+    };
+
+    //@ Estado exclusivo de um trabalhador
+    struct Worker {
+        int* distance;
+        int* parent;
+        bool* settled;
+        IndexedMinHeap* heap;
+        CacheEntry* cache;
+        int cacheHits;
+        int cacheMisses;
+    };
+
+    //@ Número de entradas da fatia de cache de cada trabalhador (potência de 2)
+    static constexpr int CACHE_SLOTS = 1024;
+
+    //@ Topologia em CSR: vizinhos de u em targets[offsets[u] .. offsets[u + 1]), com os dados de cada aresta
+    int numVertices;
+    int* offsets;
+    int* targets;
+    EdgeInfo* edges;
+
+    //@ Cópia dos perfis de latência referenciados pelas arestas
+    LatencyProfile* profiles;
+    int numProfiles;
+
+    //@ Indica se as consultas usam chegada mais cedo (latência avaliada ao chegar em cada armazém)
+    bool timeDependent;
+
+    //@ Trabalhadores
+    Worker* workers;
+    int numWorkers;
+
+    //@ Dijkstra a partir de origin no vetor de trabalho do trabalhador; para ao fixar target (-1 calcula a árvore toda)
+    void search(Worker& worker, int origin, double weightFactor, int time, int target) const;
+
+    //@ Monta a rota até destination a partir da última busca do trabalhador
+    Route buildRoute(const Worker& worker, int destination, int packageWeight, int time) const;
+
+    //@ Posição da consulta na fatia de cache
+    static int cacheSlot(int origin, int destination, int weight, int time) noexcept;
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param graph Grafo copiado na construção (alterações posteriores não afetam o serviço)
+    //@ @param numWorkers Número de trabalhadores (0 usa todos os núcleos)
+    RouteService(const GraphExtended& graph, int numWorkers = 0);
+    ~RouteService();
+
+    RouteService(const RouteService&) = delete;
+    RouteService& operator=(const RouteService&) = delete;
+
+    //@ Funções que retornam o número de trabalhadores e de armazéns
+    int getNumWorkers() const noexcept;
+    int getNumVertices() const noexcept;
+
+    //@ Melhor rota entre dois armazéns para partida no instante time (rota vazia se não houver ou se o peso for menor que 1)
+    //@ @param workerId Trabalhador em [0, getNumWorkers()), usado por uma única thread por vez
+    Route findBestRoute(int origin, int destination, int packageWeight, int time, int workerId);
+
+    //@ Calcula em lote as rotas de vários pares no instante time, com uma árvore por (origem, peso)
+    //@ Pares com peso menor que 1 ficam com a rota vazia
+    //@ Os grupos são distribuídos no pool, cujo ID de trabalhador indexa os trabalhadores do serviço
+    //@ @param pool Pool com no máximo getNumWorkers() threads
+    void findBestRoutes(const int* origins, const int* destinations, const int* weights, int count, Route* routes, int time, ThreadPool& pool);
+
+    //@ Calcula a árvore de caminhos mínimos a partir de origin no instante time (a mesma usada por findBestRoutes)
+    //@ @param parent Recebe o predecessor de cada armazém (-1 na raiz, -2 se inalcançável), com getNumVertices() posições
+    //@ Lança std::invalid_argument se packageWeight for menor que 1
+    //@ @param workerId Trabalhador em [0, getNumWorkers()), usado por uma única thread por vez
+    void findShortestPathTree(int origin, int packageWeight, int time, int workerId, int* parent);
+
+    //@ Funções que retornam os acertos e faltas de cache somados de todos os trabalhadores
+    int getCacheHits() const noexcept;
+    int getCacheMisses() const noexcept;
+};
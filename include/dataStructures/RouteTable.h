@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+//@ Forward declarations
+class Graph;
+class GraphExtended;
+
+//@ Classe que guarda as árvores de rota de todos os pares de armazéns de uma topologia
+//@ Cada camada corresponde a um peso de pacote e guarda, para cada origem, o predecessor de cada armazém;
+//@ o caminho origem -> destino é recuperado andando pelos predecessores a partir do destino
+//@ A tabela é salva em arquivo (por padrão <entrada>.rt) e identificada por um hash da seção do grafo,
+//@ de modo que as cargas seguintes da mesma topologia a mapeiam (mmap) em vez de recalcular as rotas
+class RouteTable {
+  private:
+    //@ Número de armazéns e de camadas
+    int numVertices;
+    int numLayers;
+
+    //@ Hash da topologia para a qual a tabela foi calculada
+    unsigned long long topologyHash;
+
+    //@ Peso de pacote de cada camada e predecessores em parents[(camada * n + origem) * n + armazém]
+    //@ (-1 na origem, -2 se inalcançável)
+    const int* layerWeights;
+    const int* parents;
+
+    //@ Memória da tabela: região mapeada do arquivo ou vetor próprio (apenas um dos dois é usado)
+    void* mapping;
+    size_t mappingSize;
+    int* ownedData;
+
+    RouteTable();
+
+    //@ Aloca uma tabela própria vazia
+    static RouteTable* allocate(int numVertices, const int* weights, int numLayers, unsigned long long hash);
+
+    //@ Verifica os predecessores de um arquivo carregado: cada um em [-2, n), -1 só na origem e toda cadeia
+    //@ alcançável chega à origem em até n passos, sem ciclos (uma tabela corrompida faria writePath não terminar)
+    bool hasValidStructure() const;
+
+  public:
+    //@ Destrutor (desfaz o mapeamento ou libera a memória própria)
+    ~RouteTable();
+
+    RouteTable(const RouteTable&) = delete;
+    RouteTable& operator=(const RouteTable&) = delete;
+
+    //@ Calcula a tabela do grafo base: uma camada com as árvores de BFS (as rotas de Routing::calculateRoutes)
+    //@ @param numThreads Número de threads (0 usa todos os núcleos)
+    static RouteTable* build(const Graph& graph, int numThreads = 0);
+
+    //@ Calcula a tabela do grafo estendido: uma camada por peso com as árvores de findBestRoutes no instante zero
+    //@ O motor dependente do tempo é respeitado; a hierarquia de contração não (pode desempatar diferente)
+    //@ @param numThreads Número de threads (0 usa todos os núcleos)
+    static RouteTable* build(const GraphExtended& graph, const int* weights, int numWeights, int numThreads = 0);
+
+    //@ Mapeia a tabela salva em filename
+    //@ @param expectedHash Hash da topologia carregada (computeTopologyHash)
+    //@ @return nullptr se o arquivo não existir, for inválido (inclusive predecessores corrompidos) ou de outra topologia
+    static RouteTable* loadFromFile(const std::string& filename, unsigned long long expectedHash);
+
+    //@ Salva a tabela em filename; retorna false se a escrita falhar
+    bool saveToFile(const std::string& filename) const;
+
+    //@ Funções que calculam o hash (FNV-1a) da topologia: armazéns, arestas e tudo que afeta as rotas
+    static unsigned long long computeTopologyHash(const Graph& graph);
+    static unsigned long long computeTopologyHash(const GraphExtended& graph);
+
+    //@ Funções que retornam o número de armazéns, de camadas e o hash da topologia
+    int getNumVertices() const noexcept;
+    int getNumLayers() const noexcept;
+    unsigned long long getTopologyHash() const noexcept;
+
+    //@ Função que retorna a camada de um peso de pacote (-1 se não houver)
+    int findLayer(int weight) const noexcept;
+
+    //@ Função que indica se a tabela foi mapeada de um arquivo
+    bool isMapped() const noexcept;
+
+    //@ Função que escreve o caminho origem -> destino de uma camada
+    //@ @param path Recebe os armazéns do caminho, com pelo menos getNumVertices() posições
+    //@ @return Tamanho do caminho (0 se não houver ou se os IDs forem inválidos)
+    int writePath(int layer, int origin, int destination, int* path) const;
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "../utils/RegionArena.h"
+#include "NeighborLists.h"
+#include <algorithm>
+#include <utility>
+
+//@ Classe que guarda as seções de um armazém só para os destinos que ele usa, e não para todos os armazéns
+//@ As seções ficam em um vetor denso do tamanho do grau de saída; o mapa destino -> seção é um vetor ordenado
+//@ de destinos, paralelo ao de seções, consultado por busca binária
+//@ Destinos fora da vizinhança inicial (desvios, armazenamento secundário) ganham uma seção no primeiro uso
+//@ Section precisa de construtor padrão, destrutor trivial e atribuição por movimento
+template <typename Section>
+class SectionMap {
+  private:
+    //@ Seções e seus destinos (em ordem crescente de destino), quantidade e capacidade dos vetores
+    Section* sections;
+    int* destinations;
+    int numSections;
+    int capacity;
+
+    //@ Região do cenário de onde vêm os vetores (nullptr usa o heap)
+    RegionArena* arena;
+
+    //@ Aloca vetores de count seções e destinos
+    Section* allocateSections(int count) { return arena ? arena->allocateArray<Section>(count) : new Section[count]; }
+    int* allocateDestinations(int count) { return arena ? arena->allocateArray<int>(count) : new int[count]; }
+
+    //@ Devolve vetores ao heap (na região eles são liberados junto com ela)
+    void releaseArrays() noexcept {
+        if (arena == nullptr) {
+            delete[] sections;
+            delete[] destinations;
+        }
+    }
+
+    //@ Posição da primeira seção cujo destino não é menor que destinationId
+    int lowerBound(int destinationId) const noexcept {
+        int low = 0;
+        int high = numSections;
+        while (low < high) {
+            int mid = (low + high) / 2;
+            if (destinations[mid] < destinationId) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param neighbors Destinos que recebem seção desde o início (em qualquer ordem, sem repetições)
+    //@ @param arena Região do cenário de onde vêm os vetores (nullptr usa o heap)
+    SectionMap(NeighborView neighbors, RegionArena* arena = nullptr) : numSections(neighbors.size()), capacity(neighbors.size()), arena(arena) {
+        sections = allocateSections(capacity);
+        destinations = allocateDestinations(capacity);
+        std::copy(neighbors.begin(), neighbors.end(), destinations);
+        std::sort(destinations, destinations + numSections);
+    }
+    ~SectionMap() { releaseArrays(); }
+
+    SectionMap(const SectionMap&) = delete;
+    SectionMap& operator=(const SectionMap&) = delete;
+
+    //@ Função que retorna a seção de um destino (nullptr se o destino não tiver seção)
+    Section* find(int destinationId) noexcept {
+        int position = lowerBound(destinationId);
+        return position < numSections && destinations[position] == destinationId ? &sections[position] : nullptr;
+    }
+    const Section* find(int destinationId) const noexcept {
+        return const_cast<SectionMap*>(this)->find(destinationId);
+    }
+
+    //@ Função que cria uma seção vazia para um destino que ainda não tem e a retorna
+    //@ Ponteiros obtidos antes por find ou insert deixam de valer
+    Section& insert(int destinationId) {
+        int position = lowerBound(destinationId);
+
+        // Vetores cheios: dobra a capacidade, movendo as seções (as pilhas e filas só trocam de dono)
+        if (numSections == capacity) {
+            int newCapacity = capacity < 2 ? 2 : 2 * capacity;
+            Section* newSections = allocateSections(newCapacity);
+            int* newDestinations = allocateDestinations(newCapacity);
+            for (int i = 0; i < numSections; ++i) {
+                newSections[i] = std::move(sections[i]);
+                newDestinations[i] = destinations[i];
+            }
+            releaseArrays();
+            sections = newSections;
+            destinations = newDestinations;
+            capacity = newCapacity;
+        }
+
+        //* A seção vazia do fim desce até a posição do novo destino
+        for (int i = numSections; i > position; --i) {
+            sections[i] = std::move(sections[i - 1]);
+            destinations[i] = destinations[i - 1];
+        }
+        sections[position] = Section();
+        destinations[position] = destinationId;
+        numSections++;
+        return sections[position];
+    }
+
+    //@ Funções que percorrem as seções existentes (slot de 0 a getNumSections() - 1, em ordem de destino)
+    int getNumSections() const noexcept { return numSections; }
+    int getDestination(int slot) const noexcept { return destinations[slot]; }
+    Section& at(int slot) noexcept { return sections[slot]; }
+    const Section& at(int slot) const noexcept { return sections[slot]; }
+};
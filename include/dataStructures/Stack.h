@@ -1,59 +1,215 @@
 #pragma once
 
-#include "../include/domains/Package.h"
+#include <memory>
+#include <stdexcept>
 
-//@ Forward declaration da classe Package
-class Package;
+#include "../domains/Package.h"
 
-// @ Classe que representa uma pilha de pacotes armazenada no Warehouse
-class Stack {
+// @ Classe que representa uma pilha genérica (por padrão, de pacotes armazenados no Warehouse)
+//@ Os elementos ficam em um vetor contíguo (base na posição 0), que só cresce e é reaproveitado entre
+//@ esvaziamentos: empilhar e desempilhar não alocam, e espiar qualquer posição é O(1)
+//@ O vetor é obtido do alocador (std::allocator por padrão)
+template <typename T, typename Allocator = std::allocator<T>>
+class BasicStack {
   private:
-    //@ Struct de implemtação de um nó
-    struct Node {
-        //@ Ponteiro para o pacote armazenado no nó
-        Package* package;
+    typedef std::allocator_traits<Allocator> Traits;
 
-        //@ Ponteiro para o próximo nó na pilha
-        Node* next;
-    };
+    //@ Alocador do vetor
+    Allocator allocator;
+
+    //@ Vetor de elementos, da base para o topo
+    T* items;
+
+    //@ Capacidade do vetor
+    int capacity;
 
     //@ Armazena o tamanho atual da pilha
     int currentSize;
 
-    //@ Ponteiro para o topo da pilha
-    Node* top;
+    //@ Garante espaço para pelo menos minCapacity elementos
+    void reserve(int minCapacity);
+
+    //@ Destrói os elementos e devolve o vetor ao alocador
+    void release() noexcept;
 
   public:
     // TODO: ADICIONAR CAPACIDADE MAXIMA DE ARMAZENAMENTO NO CONSTRUTOR DA PILHA
     // (PONTO EXTRA)
     //@ Construtor e destrutor
-    Stack();
-    ~Stack();
+    //@ @param allocator Alocador do vetor
+    explicit BasicStack(const Allocator& allocator = Allocator());
+    ~BasicStack();
 
-    //@ Construtor de cópia
-    Stack(const Stack& other);
+    //@ Construtor de cópia e operador de atribuição
+    BasicStack(const BasicStack& other);
+    BasicStack& operator=(const BasicStack& other);
 
     //@ Função que retorna a capacidade da pilha
-    int getCapacity() const noexcept;
+    int getCapacity() const noexcept {
+        // For now, return unlimited capacity
+        // This could be modified to implement limited capacity (extra points)
+        return -1; // -1 indicates unlimited capacity
+    }
 
     //@ Função que retorna o tamanho atual da pilha
-    int getCurrentSize() const noexcept;
+    int getCurrentSize() const noexcept { return currentSize; }
 
     //@ Função que verifica se a pilha está vazia
-    bool isEmpty() const noexcept;
+    bool isEmpty() const noexcept { return currentSize == 0; }
+
+    //@ Função que adiciona um elemento à pilha
+    //@ @param value Elemento a ser adicionado
+    void push(const T& value) {
+        if (currentSize == capacity) {
+            reserve(currentSize + 1);
+        }
+        Traits::construct(allocator, items + currentSize, value);
+        currentSize++;
+    }
+
+    //@ Função que remove e retorna o elemento do topo da pilha
+    T pop();
+
+    //@ Função que retorna o elemento do topo da pilha sem removê-lo
+    const T& peek() const;
+
+    //@ Função que retorna o elemento em uma posição específica da pilha (0 é o topo), em O(1)
+    //@ @param index Índice do elemento a ser retornado
+    //@ @return Elemento na posição especificada, ou T() (nullptr para ponteiros) se o índice for inválido
+    T peek(int index) const;
+
+    //@ Função que remove os count elementos do topo de uma vez
+    //@ @param out Recebe os elementos na ordem em que pop os retornaria (out[0] é o topo)
+    void popTop(int count, T* out);
+
+    //@ Função que empilha count elementos de uma vez, desfazendo um popTop com o mesmo vetor
+    //@ (values[count - 1] é empilhado primeiro e values[0] fica no topo)
+    void pushRange(const T* values, int count);
+};
+
+//@ Pilha de pacotes
+typedef BasicStack<Package*> Stack;
+
+//@ Instanciada em Stack.cpp
+extern template class BasicStack<Package*>;
+
+// --- Implementação ---
+
+template <typename T, typename Allocator>
+BasicStack<T, Allocator>::BasicStack(const Allocator& allocator) : allocator(allocator), items(nullptr), capacity(0), currentSize(0) {}
+
+template <typename T, typename Allocator>
+BasicStack<T, Allocator>::~BasicStack() {
+    release();
+}
+
+template <typename T, typename Allocator>
+BasicStack<T, Allocator>::BasicStack(const BasicStack& other)
+    : allocator(Traits::select_on_container_copy_construction(other.allocator)), items(nullptr), capacity(0), currentSize(0) {
+    *this = other;
+}
+
+template <typename T, typename Allocator>
+BasicStack<T, Allocator>& BasicStack<T, Allocator>::operator=(const BasicStack& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    // A base continua na posição 0, então a ordem é preservada copiando o vetor
+    while (currentSize > 0) {
+        Traits::destroy(allocator, items + --currentSize);
+    }
+    reserve(other.currentSize);
+    for (int i = 0; i < other.currentSize; ++i) {
+        Traits::construct(allocator, items + i, other.items[i]);
+    }
+    currentSize = other.currentSize;
+    return *this;
+}
+
+template <typename T, typename Allocator>
+T BasicStack<T, Allocator>::pop() {
+    if (isEmpty()) {
+        throw std::out_of_range("Pilha vazia: Não é possível executar pop.");
+    }
+    currentSize--;
+    T value = items[currentSize];
+    Traits::destroy(allocator, items + currentSize);
+    return value;
+}
+
+template <typename T, typename Allocator>
+const T& BasicStack<T, Allocator>::peek() const {
+    if (isEmpty()) {
+        throw std::out_of_range("Pilha vazia: Não é possível executar peek.");
+    }
+    return items[currentSize - 1];
+}
+
+template <typename T, typename Allocator>
+T BasicStack<T, Allocator>::peek(int index) const {
+    if (index < 0 || index >= currentSize) {
+        return T();
+    }
+    return items[currentSize - 1 - index];
+}
+
+template <typename T, typename Allocator>
+void BasicStack<T, Allocator>::popTop(int count, T* out) {
+    if (count < 0 || count > currentSize) {
+        throw std::out_of_range("Pilha sem elementos suficientes: Não é possível executar popTop.");
+    }
+    for (int i = 0; i < count; ++i) {
+        T* slot = items + currentSize - 1 - i;
+        out[i] = *slot;
+        Traits::destroy(allocator, slot);
+    }
+    currentSize -= count;
+}
+
+template <typename T, typename Allocator>
+void BasicStack<T, Allocator>::pushRange(const T* values, int count) {
+    if (count <= 0) {
+        return;
+    }
+    reserve(currentSize + count);
+    for (int i = count - 1; i >= 0; --i) {
+        Traits::construct(allocator, items + currentSize, values[i]);
+        currentSize++;
+    }
+}
 
-    //@ Função que adiciona um pacote à pilha
-    //@ @param package Ponteiro para o pacote a ser adicionado
-    void push(Package* package);
+template <typename T, typename Allocator>
+void BasicStack<T, Allocator>::reserve(int minCapacity) {
+    if (minCapacity <= capacity) {
+        return;
+    }
 
-    //@ Função que remove e retorna o pacote do topo da pilha
-    Package* pop();
+    int newCapacity = capacity == 0 ? 8 : capacity * 2;
+    if (newCapacity < minCapacity) {
+        newCapacity = minCapacity;
+    }
 
-    //@ Função que retorna o pacote do topo da pilha sem removê-lo
-    const Package* peek() const;
+    T* newItems = Traits::allocate(allocator, newCapacity);
+    for (int i = 0; i < currentSize; ++i) {
+        Traits::construct(allocator, newItems + i, items[i]);
+        Traits::destroy(allocator, items + i);
+    }
+    if (items != nullptr) {
+        Traits::deallocate(allocator, items, capacity);
+    }
+    items = newItems;
+    capacity = newCapacity;
+}
 
-    //@ Função que retorna o pacote em uma posição específica da pilha
-    //@ @param index Índice do pacote a ser retornado
-    //@ @return Ponteiro para o pacote na posição especificada, ou nullptr se o índice
-    Package* peek(int index) const;
-};
\ No newline at end of file
+template <typename T, typename Allocator>
+void BasicStack<T, Allocator>::release() noexcept {
+    while (currentSize > 0) {
+        Traits::destroy(allocator, items + --currentSize);
+    }
+    if (items != nullptr) {
+        Traits::deallocate(allocator, items, capacity);
+    }
+    items = nullptr;
+    capacity = 0;
+}
@@ -1,55 +1,48 @@
 #pragma once
 
-#include "dataStructures/LinkedList.h"
 #include "dataStructures/Graph.h"
+#include "dataStructures/RouteArena.h"
+#include "dataStructures/RoutePath.h"
+#include "PackageTable.h"
 #include <string>
 
 class Graph;
-
-//@ Enum que define os estados possíveis de um pacote
-enum PackageState {
-    NOT_POSTED,
-    SCHEDULED,
-    STORED,
-    REMOVED_FOR_TRANSPORT,
-    DELIVERED,
-};
-//@ Classe que representa um pacote
+class RouteTable;
+class ThreadPool;
+class IntrusiveStack;
+class IntrusiveQueue;
+
+//@ Classe que representa um pacote: um identificador (tabela + índice) para uma linha da PackageTable do cenário
+//@ Não é guardado por pacote; é criado na pilha a partir do índice (eventos, pilhas e filas guardam só o índice)
+//@ e copiado por valor. As rotas são IDs na RouteArena do cenário (PackageTable::getRoutes)
 class Package {
-  private:
-    //@ Atributo que guarda o ID único do pacote
-    int ID;
-
-    //@ Atributos que guardam o armazém de origem e destino do pacote
-    int initialOrigin, finalDestination;
-
-    //@ Atributo que guarda a data de postagem do pacote
-    int postTime;
-
-    //@ Atributos que guardam o tempo que o pacote foi armazenado, o tempo em
-    //@ trânsito e o tempo esperado de armazenamento
-    int timeStored, timeInTransit;
-
-    //@ Atributo que guarda a localização atual do pacote (começa como o armazém
-    //@ origem)
-    int currentLocation;
+  protected:
+    //@ Tabela com os atributos do pacote (nullptr no identificador vazio)
+    PackageTable* table;
 
-    //@ Atributo que guarda o estado do pacote (começa como NOT_POSTED)
-    PackageState state;
+    //@ Índice (ID denso) da linha do pacote na tabela
+    int index;
 
-    //@ Atributo que guarda a rota ótima entre armazéns para o pacote
-    LinkedList route;
+    friend class IntrusiveStack;
+    friend class IntrusiveQueue;
 
   public:
+    //@ Construtor do identificador vazio (não aponta para nenhum pacote)
+    Package() noexcept : table(nullptr), index(-1) {}
+
     //@ Construtor padrão
-    //@ @param ID ID único do pacote
-    Package(int ID, int initialOrigin, int finalDestination, int postTime);
+    //@ @param table Tabela de pacotes do cenário
+    //@ @param index Índice da linha do pacote na tabela (ver PackageTable::add)
+    Package(PackageTable& table, int index) noexcept : table(&table), index(index) {}
+
+    //@ Função que indica se o identificador aponta para um pacote
+    explicit operator bool() const noexcept { return table != nullptr; }
 
     //@ Função que retorna o ID do pacote
     int getId() const noexcept;
 
-    //@ Função que retorna o tipo do pacote
-    std::string getType() const noexcept;
+    //@ Função que retorna o índice do pacote na PackageTable
+    int getIndex() const noexcept;
 
     //@ Função que retorna o armazém de origem do pacote
     int getInitialOrigin() const noexcept;
@@ -60,35 +53,46 @@ class Package {
     //@ Função que retorna a data de postagem do pacote
     int getPostTime() const noexcept;
 
-    //@ Função que retorna o tempo armazenado do pacote
-    int getTimeStored() const noexcept;
-
-    //@ Função que retorna o tempo em trânsito do pacote
-    int getTimeInTransit() const noexcept;
-
     //@ Função que retorna a localização atual do pacote
     int getCurrentLocation() const noexcept;
 
     //@ Função que retorna o estado do pacote
     PackageState getState() const noexcept;
 
-    //@ Função que retorna a rota ótima entre armazéns para o pacote
-    LinkedList& getRoute() noexcept;
+    //@ Função que retorna o ID do caminho da rota na RouteArena
+    int getRouteId() const noexcept;
+
+    //@ Função que retorna a posição do armazém atual no caminho da rota
+    int getRouteHop() const noexcept;
+
+    //@ Função que retorna a arena de rotas do cenário, onde estão os caminhos dos IDs de rota
+    RouteArena& getRouteArena() const noexcept;
 
-    //@ Função que seta o tempo que o pacote ficou em trânsito
-    //@ @param time Tempo que o pacote ficou em trânsito
-    void setTimeInTransit(int time);
+    //@ Função que retorna quantos armazéns ainda restam na rota (incluindo o atual)
+    int getRemainingRouteSize() const;
+
+    //@ Função que retorna uma cópia da rota restante (do armazém atual ao destino)
+    //@ Compatível com o antigo getRoute(); rotas curtas não alocam
+    RoutePath getRoute() const;
+
+    //@ Função que retorna um armazém da rota restante sem removê-lo
+    //@ @param ahead Quantos saltos à frente do armazém atual (0 é o próprio armazém atual)
+    int peekRoute(int ahead = 0) const;
+
+    //@ Função que avança a rota em um salto
+    void advanceRoute();
 
     //@ Função que seta a localização atual do pacote
     //@ @param location ID do armazém onde o pacote está localizado
     void setCurrentLocation(int location);
 
-    //@ Função que seta o tempo de armazenamento do pacote
-    //@ @param time Tempo que o pacote ficou armazenado
-    void setTimeStored(int time);
+    //@ Função que seta a rota do pacote a partir de um caminho já internado
+    //@ @param pathId ID do caminho na RouteArena do cenário
+    //@ @param hop Posição do armazém atual no caminho
+    void setRoute(int pathId, int hop = 0) noexcept;
 
-    //@ Função que seta a melhor rota entre armazéns para o pacote
-    void setRoute(LinkedList&& newRoute) noexcept;
+    //@ Função que interna uma rota e a seta como rota do pacote
+    void setRoute(const RoutePath& newRoute);
 
     //@ Função que seta o estado do pacote
     void setState(PackageState newState) noexcept;
@@ -101,5 +105,47 @@ namespace Routing {
 //@ @param originID ID do armazém de origem
 //@ @param destinationID ID do armazém de destino
 //@ @param graph Grafo que representa os armazéns e suas conexões
-LinkedList calculateOptimalRoute(int origninID, int destinationID, const Graph& graph);
+RoutePath calculateOptimalRoute(int origninID, int destinationID, const Graph& graph);
+
+//@ Função que calcula em lote as rotas de todos os pacotes, com uma única BFS por origem distinta
+//@ As origens são processadas em paralelo; cada rota é idêntica à de calculateOptimalRoute
+//@ @param packages Tabela de pacotes do cenário (as rotas são internadas na arena da tabela)
+//@ @param graph Grafo que representa os armazéns e suas conexões
+//@ @param pool Threads do cenário (ver ConfigData::pool)
+//@ @param table Tabela de rotas pré-calculada da mesma topologia (com ela nenhuma BFS é feita)
+void calculateRoutes(PackageTable& packages, const Graph& graph, ThreadPool& pool, const RouteTable* table = nullptr);
+
+//@ Classe que calcula rotas sob demanda, uma por vez, com as mesmas árvores de calculateRoutes
+//@ Guarda as árvores de BFS das origens usadas recentemente (mapeamento direto por origem)
+class OnDemandRouter {
+  private:
+    //@ Grafo, arena de rotas do cenário e tabela pré-calculada opcional
+    const Graph& graph;
+    RouteArena& arena;
+    const RouteTable* table;
+
+    //@ Árvores guardadas: origem de cada posição (-1 se vazia) e predecessores
+    int numSlots;
+    int* slotOrigin;
+    int** slotParent;
+
+    //@ Vetores de trabalho da BFS e da montagem do caminho
+    int* bfsQueue;
+    int* pathBuffer;
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param graph Grafo que representa os armazéns e suas conexões
+    //@ @param arena Arena de rotas do cenário, onde as rotas são internadas
+    //@ @param table Tabela de rotas pré-calculada da mesma topologia (dispensa as BFS)
+    //@ @param numSlots Número máximo de árvores guardadas
+    OnDemandRouter(const Graph& graph, RouteArena& arena, const RouteTable* table = nullptr, int numSlots = 64);
+    ~OnDemandRouter();
+
+    OnDemandRouter(const OnDemandRouter&) = delete;
+    OnDemandRouter& operator=(const OnDemandRouter&) = delete;
+
+    //@ Função que retorna o ID na RouteArena da rota origem -> destino (0 se não houver caminho)
+    int route(int origin, int destination);
+};
 } // namespace Routing
\ No newline at end of file
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "../dataStructures/LinkedList.h"
 #include "Package.h"
 
 //@ Enum que define os tipos de pacotes por peso
@@ -12,26 +11,17 @@ enum PackageWeightClass {
 };
 
 //@ Classe que representa um pacote com peso variável
+//@ Também é só um identificador: os atributos estendidos ficam nas colunas estendidas da PackageTable
 class PackageExtended : public Package {
-  private:
-    //@ Peso do pacote
-    int weight;
-
-    //@ Classe de peso do pacote
-    PackageWeightClass weightClass;
-
-    //@ Histórico de rotas utilizadas
-    LinkedList routeHistory;
-
-    //@ Tempo de roteamento dinâmico
-    int lastRouteCalculation;
+  public:
+    //@ Construtor do identificador vazio
+    PackageExtended() noexcept = default;
 
-    //@ Indicador se o pacote requer roteamento especial
-    bool requiresSpecialHandling;
+    //@ Construtor padrão (a tabela deve ser estendida, ver PackageTable::addExtended)
+    PackageExtended(PackageTable& table, int index) noexcept : Package(table, index) {}
 
-  public:
-    //@ Construtor estendido
-    PackageExtended(int ID, int initialOrigin, int finalDestination, int postTime, int weight = 1, bool specialHandling = false);
+    //@ Construtor a partir do identificador base de um pacote da mesma tabela estendida
+    explicit PackageExtended(const Package& package) noexcept : Package(package) {}
 
     //@ Função que retorna o peso do pacote
     int getWeight() const noexcept;
@@ -42,14 +32,14 @@ class PackageExtended : public Package {
     //@ Função que retorna se requer manuseio especial
     bool getRequiresSpecialHandling() const noexcept;
 
-    //@ Função que retorna o histórico de rotas
-    const LinkedList& getRouteHistory() const noexcept;
+    //@ Função que retorna quantos armazéns restavam na rota substituída no último recálculo (0 se não houve)
+    int getPreviousRouteSize() const;
 
     //@ Função que retorna o tempo da última calculação de rota
     int getLastRouteCalculation() const noexcept;
 
-    //@ Função que adiciona uma rota ao histórico
-    void addRouteToHistory(const LinkedList& route);
+    //@ Função que guarda a rota atual como a rota anterior, antes de um recálculo (só a última é mantida)
+    void saveRouteAsPrevious() noexcept;
 
     //@ Função que atualiza o tempo da última calculação de rota
     void updateLastRouteCalculation(int time);
@@ -62,5 +52,5 @@ class PackageExtended : public Package {
 
   private:
     //@ Função para determinar a classe de peso baseada no peso
-    PackageWeightClass determineWeightClass(int weight);
+    static PackageWeightClass determineWeightClass(int weight) noexcept;
 };
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+
+//* Forward declarations
+class Package;
+class PackageExtended;
+class IntrusiveStack;
+class IntrusiveQueue;
+class RegionArena;
+class RouteArena;
+
+//@ Enum que define os estados possíveis de um pacote (um byte por pacote na PackageTable)
+enum PackageState : std::uint8_t {
+    NOT_POSTED,
+    SCHEDULED,
+    STORED,
+    REMOVED_FOR_TRANSPORT,
+    DELIVERED,
+    UNDELIVERABLE, // Sem caminho até o destino e sem reabertura de aresta pendente (simulação estendida)
+};
+
+//@ Classe que guarda os atributos dos pacotes de um cenário em colunas (struct-of-arrays), indexadas pelo ID denso do pacote
+//@ As colunas quentes (estado, localização, rota e gancho intrusivo) são lidas ou escritas a cada salto; as frias
+//@ (ID, origem, destino e postagem) quase nunca, e ficam em outro bloco para não dividir as linhas de cache com as quentes
+//@ Não existe objeto por pacote: Package é só um identificador (tabela + índice) criado na pilha quando necessário
+//@ Os atributos da simulação estendida ficam em colunas próprias, alocadas só quando a tabela é estendida
+class PackageTable {
+  private:
+    //@ Número máximo de pacotes e número de pacotes adicionados
+    int capacity;
+    int size;
+
+    //@ Colunas quentes; links guarda o índice do próximo pacote na pilha de seção ou fila de espera (-1 se nenhum)
+    std::uint8_t* states;
+    std::int32_t* currentLocations;
+    std::int32_t* routeIds;
+    std::int32_t* routeHops;
+    std::int32_t* links;
+
+    //@ Colunas frias
+    std::int32_t* ids;
+    std::int32_t* initialOrigins;
+    std::int32_t* finalDestinations;
+    std::int32_t* postTimes;
+
+    //@ Colunas estendidas (nullptr se a tabela não for estendida)
+    //@ A rota anterior é a substituída no último recálculo (caminho 0, a rota vazia, se nunca houve)
+    std::uint8_t* weights;
+    std::uint8_t* specialHandling;
+    std::int32_t* lastRouteCalculations;
+    std::int32_t* previousRouteIds;
+    std::int32_t* previousRouteHops;
+
+    //@ Rotas internadas do cenário, referenciadas pelos IDs da coluna routeIds
+    RouteArena* routes;
+
+    //@ Região de onde vieram as colunas (nullptr se foram alocadas com new[])
+    RegionArena* arena;
+
+    //@ Função que aloca uma coluna na região do cenário ou no heap
+    template <typename T>
+    T* allocateColumn();
+
+    friend class Package;
+    friend class PackageExtended;
+    friend class IntrusiveStack;
+    friend class IntrusiveQueue;
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param capacity Número máximo de pacotes
+    //@ @param routes Arena de rotas do cenário (deve viver tanto quanto a tabela)
+    //@ @param arena Região do cenário de onde vêm as colunas (nullptr usa o heap)
+    //@ @param extended Se as colunas da simulação estendida devem ser alocadas
+    PackageTable(int capacity, RouteArena& routes, RegionArena* arena = nullptr, bool extended = false);
+    ~PackageTable();
+
+    PackageTable(const PackageTable&) = delete;
+    PackageTable& operator=(const PackageTable&) = delete;
+
+    //@ Função que adiciona uma linha (estado NOT_POSTED, rota vazia) e retorna seu índice
+    //@ Os índices são densos, na ordem de adição
+    int add(int ID, int initialOrigin, int finalDestination, int postTime);
+
+    //@ Função que adiciona uma linha de pacote estendido (a tabela deve ser estendida)
+    int addExtended(int ID, int initialOrigin, int finalDestination, int postTime, int weight, bool requiresSpecialHandling);
+
+    //@ Funções que retornam o número de pacotes adicionados e a capacidade
+    int getSize() const noexcept;
+    int getCapacity() const noexcept;
+
+    //@ Função que indica se as colunas da simulação estendida foram alocadas
+    bool isExtended() const noexcept;
+
+    //@ Função que retorna a arena de rotas do cenário
+    RouteArena& getRoutes() const noexcept;
+
+    //@ Funções que expõem as colunas de estado e de postagem para varreduras (getSize() entradas)
+    const std::uint8_t* getStates() const noexcept;
+    const std::int32_t* getPostTimes() const noexcept;
+
+    //@ Função que conta os pacotes em um estado (lê um byte por pacote; o laço é vetorizado)
+    int countInState(PackageState state) const noexcept;
+};
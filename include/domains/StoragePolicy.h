@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+//@ Enum que define a disciplina de armazenamento das seções, escolhida por cenário
+//@ A disciplina decide em que posição da seção cada pacote é guardado; no transporte os pacotes saem pelo topo
+//@ Custo de cada uma (um removalCost por pacote manuseado):
+//@  - LIFO: pilha; todos os pacotes da seção são removidos e os que não couberem no transporte são rearmazenados
+//@  - demais: a seção é uma esteira carregada por trás e esvaziada pela frente, então só os pacotes transportados
+//@    são removidos; nas ordenadas, guardar um pacote no meio desloca os pacotes entre ele e a ponta mais próxima
+//@    (min(acima, abaixo)), rearmazenados antes da próxima partida da seção (ver takePendingMoves)
+//@ Guardar em uma das pontas (chegadas em ordem, FIFO) não desloca nenhum pacote
+enum StoragePolicy {
+    LIFO_STORAGE,           // Pilha: guardado no topo; sai primeiro o mais antigo, depois de desempilhar todos (regra original)
+    FIFO_STORAGE,           // Esteira: guardado no fim, sai pela frente na ordem de chegada
+    AGE_PRIORITY_STORAGE,   // Prateleira ordenada pela postagem: o pacote postado há mais tempo sai primeiro
+    WEIGHT_ORDERED_STORAGE, // Prateleira ordenada pelo peso: o mais leve sai primeiro (pacotes sem peso valem 1)
+};
+
+//@ Função que retorna o nome da disciplina usado nas opções e nos relatórios ("lifo", "fifo", "idade" ou "peso")
+const char* storagePolicyName(StoragePolicy policy) noexcept;
+
+//@ Função que converte um nome de disciplina (ver storagePolicyName)
+//@ @return false se o nome não for de nenhuma disciplina (policy não é alterado)
+bool parseStoragePolicy(const std::string& name, StoragePolicy& policy);
@@ -1,37 +1,53 @@
 #pragma once
 
-#include "dataStructures/Stack.h"
+#include "dataStructures/IntrusiveStack.h"
+#include "dataStructures/SectionMap.h"
+#include "domains/StoragePolicy.h"
 
 //* Forward declarations
 class Package;
-class Stack;
+class RegionArena;
 
 //@ Classe que implementa o domínio armazem
 class Warehouse {
   private:
     //@ Struct que implementa uma sessão de armazém (guardando a pilha de pacotes para um armazém específico )
     struct Session {
-        //@ Atributo que guarda o ID do destino
-        int destinationId;
+        //@ Atributo que guarda a pilha de pacotes para o destino (encadeada pelos próprios pacotes, sem alocação)
+        IntrusiveStack stack;
 
-        //@ Atributo que guarda a pilha de pacotes para o destino
-        Stack stack;
+        //@ Pacotes deslocados por inserções ordenadas desde a última partida (ver StoragePolicy)
+        int pendingMoves = 0;
     };
 
     //@ Atributo identificador do armazém
     int ID;
 
-    //@ Pilhas de pacotes do armazém (escolha de array pois o acesso se torna mais
-    // rapido)
-    Session* sessions;
+    //@ Pilhas de pacotes do armazém, uma por vizinho (o destino de cada uma fica no mapa)
+    SectionMap<Session> sessions;
 
     //@ Total de armazens no sistema
     int totalWarehouses;
 
+    //@ Disciplina de armazenamento das seções
+    StoragePolicy storagePolicy;
+
+    //@ Retorna a sessão de um destino, criando-a no primeiro uso (nullptr se o destino não existir)
+    Session* sessionFor(int destinationId);
+
+    //@ Retorna a pilha de um destino, criando-a no primeiro uso (nullptr se o destino não existir)
+    IntrusiveStack* sectionFor(int destinationId);
+
+    //@ Retorna a pilha de um destino para consulta (uma pilha vazia se o destino não tiver seção)
+    const IntrusiveStack& sectionAt(int destinationId) const noexcept;
+
   public:
     //@ Construtor
     //@ @param ID Identificador único do armazém
-    Warehouse(int ID, int totalWarehouses);
+    //@ @param neighbors Armazéns vizinhos, que recebem seção de início (os demais destinos só no primeiro uso)
+    //@ @param arena Região do cenário de onde vêm as seções (nullptr usa o heap)
+    //@ @param storagePolicy Disciplina de armazenamento (o pacote base não tem peso: WEIGHT_ORDERED_STORAGE equivale a FIFO)
+    Warehouse(int ID, int totalWarehouses, NeighborView neighbors = NeighborView(), RegionArena* arena = nullptr, StoragePolicy storagePolicy = LIFO_STORAGE);
 
     //@ Destrutor
     ~Warehouse();
@@ -41,14 +57,30 @@ class Warehouse {
 
     int getSectionSize(int sectionId) const noexcept;
 
-    //@ Armazena um pacote na seção correta (operação principal)
-    void storePackage(Package* pkg, int destinationId);
+    //@ Retorna a disciplina de armazenamento das seções
+    StoragePolicy getStoragePolicy() const noexcept;
+
+    //@ Armazena um pacote na seção correta, na posição definida pela disciplina (operação principal)
+    void storePackage(const Package& pkg, int destinationId);
+
+    //@ Retorna e zera os pacotes deslocados na seção de um destino desde a última chamada
+    //@ O escalonador os rearmazena (um removalCost cada) antes de retirar os pacotes da partida
+    int takePendingMoves(int destinationId) noexcept;
 
     //@ Recupera (remove) um pacote da seção de um destino (operação principal)
-    Package* retrievePackage(int destinationId);
+    Package retrievePackage(int destinationId);
+
+    //@ Recupera de uma vez os count pacotes do topo da seção de um destino
+    //@ @param out Recebe os pacotes do topo para a base (como count chamadas de retrievePackage)
+    //@ @return Número de pacotes recuperados (0 se a seção não existir)
+    int retrievePackages(int destinationId, int count, Package* out);
+
+    //@ Devolve de uma vez ao topo da seção de um destino pacotes recuperados por retrievePackages
+    //@ @param packages Pacotes do topo para a base; a seção volta à ordem em que estava
+    void restorePackages(int destinationId, const Package* packages, int count);
 
     //@ Espia o pacote no topo de uma seção sem removê-lo
-    const Package* peekAtSection(int destinationId) const;
+    Package peekAtSection(int destinationId) const;
 
     //@ Verifica se a seção para um destino está vazia
     bool isSectionEmpty(int destinationId) const;
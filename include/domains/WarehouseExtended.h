@@ -1,23 +1,29 @@
 #pragma once
 
-#include "../dataStructures/Queue.h"
-#include "../dataStructures/Stack.h"
+#include "../dataStructures/IntrusiveQueue.h"
+#include "../dataStructures/IntrusiveStack.h"
+#include "../dataStructures/SectionMap.h"
+#include "PackageExtended.h"
+#include "StoragePolicy.h"
 #include "Warehouse.h"
+#include <functional>
 
 //@ Forward declaration
-class PackageExtended;
+class RegionArena;
 
 //@ Estrutura para representar uma seção de armazém com capacidade limitada
 struct SectionExtended {
-    int destinationId;
-    Stack stack;
+    IntrusiveStack stack; // Encadeada pelos próprios pacotes: armazenar e retirar não alocam
     int maxCapacity;
     int currentOccupancy;
     int weightCapacity;
     int currentWeight;
-    Queue waitingQueue; // Fila para pacotes esperando espaço
+    IntrusiveQueue waitingQueue; // Fila para pacotes esperando espaço
+    int pendingMoves;            // Pacotes deslocados por inserções ordenadas desde a última partida (ver StoragePolicy)
+    int recentArrivals;          // Chegadas desde o último rebalanceamento
+    double arrivalRate;          // Chegadas por intervalo, suavizadas (média móvel exponencial)
 
-    SectionExtended() : destinationId(-1), maxCapacity(100), currentOccupancy(0), weightCapacity(500), currentWeight(0) {}
+    SectionExtended() : maxCapacity(100), currentOccupancy(0), weightCapacity(500), currentWeight(0), pendingMoves(0), recentArrivals(0), arrivalRate(0.0) {}
 };
 
 //@ Classe que implementa o armazém estendido com capacidade limitada
@@ -26,8 +32,11 @@ class WarehouseExtended {
     //@ Atributo identificador do armazém
     int ID;
 
-    //@ Seções de armazém com capacidade limitada
-    SectionExtended* sections;
+    //@ Seções de armazém com capacidade limitada, uma por vizinho (o destino de cada uma fica no mapa)
+    SectionMap<SectionExtended> sections;
+
+    //@ Seção vazia com as capacidades iniciais, usada nas consultas a destinos que ainda não têm seção
+    SectionExtended blankSection;
 
     //@ Total de armazéns no sistema
     int totalWarehouses;
@@ -50,9 +59,35 @@ class WarehouseExtended {
     //@ Indicador se tem armazenamento secundário
     bool hasSecondaryStorage;
 
+    //@ Disciplina de armazenamento das seções
+    StoragePolicy storagePolicy;
+
+    //@ Instante do último rebalanceamento de capacidade (-1 se nunca houve)
+    int lastOptimizationTime;
+
+    //@ Retorna a seção de um destino, criando-a no primeiro uso (nullptr se o destino não existir)
+    SectionExtended* sectionFor(int destinationId);
+
+    //@ Retorna a seção de um destino para consulta (blankSection se o destino não tiver seção)
+    const SectionExtended& sectionAt(int destinationId) const noexcept;
+
+    //@ Coloca um pacote na pilha da seção, na posição definida pela disciplina (sem contabilizar capacidade)
+    void placeInSection(SectionExtended& section, const PackageExtended& pkg);
+
   public:
+    //@ Peso das chegadas do último intervalo na taxa suavizada de cada seção
+    static constexpr double ARRIVAL_RATE_SMOOTHING = 0.3;
+
+    //@ Fração da parcela estática que toda seção mantém no rebalanceamento
+    static constexpr double MIN_SECTION_SHARE = 0.25;
+
     //@ Construtor
-    WarehouseExtended(int ID, int totalWarehouses, int capacity = 1000, int weightCapacity = 5000);
+    //@ Cada seção recebe capacity / totalWarehouses e weightCapacity / totalWarehouses, existindo de início ou não
+    //@ @param neighbors Armazéns vizinhos, que recebem seção de início (os demais destinos só no primeiro uso)
+    //@ @param arena Região do cenário de onde vêm as seções (nullptr usa o heap)
+    //@ @param storagePolicy Disciplina de armazenamento das seções
+    WarehouseExtended(int ID, int totalWarehouses, NeighborView neighbors = NeighborView(), int capacity = 1000, int weightCapacity = 5000, RegionArena* arena = nullptr,
+                      StoragePolicy storagePolicy = LIFO_STORAGE);
 
     //@ Destrutor
     ~WarehouseExtended();
@@ -72,6 +107,9 @@ class WarehouseExtended {
     //@ Retorna o peso atual
     int getTotalCurrentWeight() const noexcept;
 
+    //@ Retorna a disciplina de armazenamento das seções
+    StoragePolicy getStoragePolicy() const noexcept;
+
     //@ Retorna a utilização percentual
     double getUtilizationPercentage() const noexcept;
 
@@ -85,22 +123,39 @@ class WarehouseExtended {
     int getSectionAvailableWeight(int sectionId) const noexcept;
 
     //@ Verifica se pode armazenar um pacote
-    bool canStorePackage(PackageExtended* pkg, int destinationId) const;
+    bool canStorePackage(const PackageExtended& pkg, int destinationId) const;
 
     //@ Armazena um pacote considerando capacidade limitada
-    bool storePackage(PackageExtended* pkg, int destinationId);
+    //@ @param countArrival Conta o pacote na taxa de chegadas da seção (falso ao devolver pacotes não transportados)
+    bool storePackage(const PackageExtended& pkg, int destinationId, bool countArrival = true);
 
     //@ Tenta armazenar na fila de espera
-    bool storeInWaitingQueue(PackageExtended* pkg, int destinationId);
+    bool storeInWaitingQueue(const PackageExtended& pkg, int destinationId);
 
     //@ Processa fila de espera quando há espaço disponível
     void processWaitingQueue(int destinationId);
 
+    //@ Retorna e zera os pacotes deslocados na seção de um destino desde a última chamada (ver Warehouse::takePendingMoves)
+    int takePendingMoves(int destinationId) noexcept;
+
     //@ Recupera (remove) um pacote da seção de um destino
-    PackageExtended* retrievePackage(int destinationId);
+    PackageExtended retrievePackage(int destinationId);
+
+    //@ Recupera count pacotes da seção de um destino, com o mesmo resultado de count chamadas de retrievePackage
+    //@ Com fila de espera cada saída pode admitir um pacote da fila, que passa a ser o próximo a sair
+    //@ @param out Recebe os pacotes na ordem de saída
+    //@ @return Número de pacotes recuperados
+    int retrievePackages(int destinationId, int count, PackageExtended* out);
+
+    //@ Remove de uma seção e da sua fila de espera os pacotes escolhidos por shouldRemove, mantendo a ordem dos demais
+    //@ Só depois a fila de espera é processada, para que nenhum pacote escolhido seja admitido na seção
+    //@ @param removed Recebe os pacotes removidos: os da seção do topo para a base, depois os da fila do início ao fim
+    //@ (com getSectionSize + getWaitingQueueSize posições)
+    //@ @return Número de pacotes removidos
+    int removePackagesIf(int destinationId, const std::function<bool(const PackageExtended&)>& shouldRemove, PackageExtended* removed);
 
     //@ Espia o pacote no topo de uma seção sem removê-lo
-    const PackageExtended* peekAtSection(int destinationId) const;
+    PackageExtended peekAtSection(int destinationId) const;
 
     //@ Verifica se a seção para um destino está vazia
     bool isSectionEmpty(int destinationId) const;
@@ -112,13 +167,17 @@ class WarehouseExtended {
     void setSecondaryStorage(int warehouseId);
 
     //@ Transfere pacote para armazenamento secundário
-    bool transferToSecondaryStorage(PackageExtended* pkg, int destinationId, WarehouseExtended** warehouses);
+    bool transferToSecondaryStorage(const PackageExtended& pkg, int destinationId, WarehouseExtended** warehouses);
 
     //@ Retorna o tamanho da fila de espera
     int getWaitingQueueSize(int destinationId) const noexcept;
 
-    //@ Função para otimizar capacidade (realoca pacotes se necessário)
-    void optimizeCapacity();
+    //@ Redistribui totalCapacity e totalWeightCapacity entre as seções existentes conforme as taxas de chegada suavizadas
+    //@ Cada seção mantém MIN_SECTION_SHARE da parcela estática (capacity / totalWarehouses) e o excedente é dividido
+    //@ proporcionalmente à taxa
+    //@ Custa O(seções) sem alocar; chamadas repetidas no mesmo instante (uma por seção que parte) só rebalanceiam na primeira
+    //@ Uma seção que encolhe abaixo da ocupação não perde pacotes: só deixa de aceitar até esvaziar
+    void optimizeCapacity(int currentTime);
 
   private:
     //@ Log para pacote esperando devido à capacidade
@@ -6,4 +6,9 @@ void logPackageStored(int time, int pkgId, int whId, int sectionId);
 void logPackageInTransit(int time, int pkgId, int originId, int destId);
 void logPackageDelivered(int time, int pkgId, int whId);
 void logPackageRemoved(int time, int pkgId, int whId, int sectionId);
-void logPackageRestored(int time, int pkgId, int whId, int sectionId);
\ No newline at end of file
+void logPackageRestored(int time, int pkgId, int whId, int sectionId);
+void logPackageUndeliverable(int time, int pkgId, int whId);
+void logSectionReshelved(int time, int whId, int sectionId, int numPackages);
+void logEdgeClosed(int time, int originId, int destId);
+void logEdgeReopened(int time, int originId, int destId);
+void logEdgeLatencyChanged(int time, int originId, int destId, int latency);
\ No newline at end of file
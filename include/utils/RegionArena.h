@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//@ Classe que implementa uma região de memória para objetos que vivem tanto quanto o cenário carregado
+//@ Alocar só avança um ponteiro dentro do bloco corrente; quando ele acaba, um bloco novo (o dobro do anterior,
+//@ até MAX_CHUNK_SIZE) é obtido com mmap, opcionalmente em páginas grandes
+//@ Os objetos nunca são liberados um a um: destruir a região devolve todos os blocos de uma vez
+//@ Tipos com destrutor não trivial são registrados por create e destruídos (em ordem inversa) antes da liberação
+class RegionArena {
+  public:
+    //@ Tamanho do primeiro bloco e limite de crescimento dos blocos
+    static constexpr size_t INITIAL_CHUNK_SIZE = size_t(1) << 20;
+    static constexpr size_t MAX_CHUNK_SIZE = size_t(64) << 20;
+
+    //@ Tamanho de uma página grande (blocos em páginas grandes são múltiplos dele)
+    static constexpr size_t HUGE_PAGE_SIZE = size_t(2) << 20;
+
+  private:
+    //@ Cabeçalho no início de cada bloco (os blocos formam uma lista, do mais novo ao mais antigo)
+    struct Chunk {
+        Chunk* previous;
+        size_t size;
+    };
+
+    //@ Destrutor pendente de um objeto criado na região (também alocado na região)
+    struct Finalizer {
+        Finalizer* previous;
+        void (*destroy)(void*);
+        void* object;
+    };
+
+    //@ Bloco corrente, próxima posição livre e fim do bloco
+    Chunk* chunks;
+    char* cursor;
+    char* limit;
+
+    //@ Tamanho do próximo bloco, uso de páginas grandes e totais para as métricas
+    size_t nextChunkSize;
+    bool hugePages;
+    size_t bytesAllocated;
+    size_t bytesReserved;
+
+    //@ Destrutores pendentes, do mais recente ao mais antigo
+    Finalizer* finalizers;
+
+    //@ Obtém um bloco novo em que caibam size bytes alinhados e retorna a memória pedida nele
+    void* allocateSlow(size_t size, size_t alignment);
+
+    //@ Mapeia e desmapeia a memória de um bloco
+    Chunk* mapChunk(size_t size);
+    static void unmapChunk(Chunk* chunk) noexcept;
+
+    template <typename T>
+    static void destroyObject(void* object) {
+        static_cast<T*>(object)->~T();
+    }
+
+  public:
+    //@ Construtor e destrutor (o destrutor chama release)
+    //@ @param hugePages Tenta obter os blocos em páginas grandes (MAP_HUGETLB, senão madvise(MADV_HUGEPAGE))
+    explicit RegionArena(bool hugePages = false);
+    ~RegionArena();
+
+    RegionArena(const RegionArena&) = delete;
+    RegionArena& operator=(const RegionArena&) = delete;
+
+    //@ Função que retorna size bytes não inicializados, alinhados em alignment (potência de dois)
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        size_t address = reinterpret_cast<size_t>(cursor);
+        size_t aligned = (address + alignment - 1) & ~(alignment - 1);
+        if (cursor == nullptr || aligned + size > reinterpret_cast<size_t>(limit)) {
+            return allocateSlow(size, alignment);
+        }
+        cursor = reinterpret_cast<char*>(aligned + size);
+        bytesAllocated += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    //@ Função que constrói um objeto na região
+    //@ Se T tiver destrutor não trivial, ele é chamado por release
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* memory = allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+        if (!std::is_trivially_destructible<T>::value) {
+            Finalizer* finalizer = static_cast<Finalizer*>(allocate(sizeof(Finalizer), alignof(Finalizer)));
+            finalizer->previous = finalizers;
+            finalizer->destroy = &destroyObject<T>;
+            finalizer->object = object;
+            finalizers = finalizer;
+        }
+        return object;
+    }
+
+    //@ Função que aloca um vetor de count elementos inicializados com o construtor padrão
+    //@ Só aceita tipos de destrutor trivial (os vetores não são registrados para destruição)
+    template <typename T>
+    T* allocateArray(int count) {
+        static_assert(std::is_trivially_destructible<T>::value, "Vetores da regiao nao sao destruidos");
+        if (count <= 0) {
+            return nullptr;
+        }
+        T* array = static_cast<T*>(allocate(sizeof(T) * static_cast<size_t>(count), alignof(T)));
+        for (int i = 0; i < count; ++i) {
+            new (array + i) T();
+        }
+        return array;
+    }
+
+    //@ Destrói os objetos registrados e devolve todos os blocos; a região volta a ficar vazia e pode ser reusada
+    void release() noexcept;
+
+    //@ Funções que retornam os bytes entregues e os bytes mapeados
+    size_t getBytesAllocated() const noexcept { return bytesAllocated; }
+    size_t getBytesReserved() const noexcept { return bytesReserved; }
+};
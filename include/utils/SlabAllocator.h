@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <string>
+#include <typeinfo>
+
+//@ Estatísticas acumuladas de um pool (ver SlabPool::getStats)
+struct SlabPoolStats {
+    std::string name;
+    int objectSize;
+    long long allocations;
+    long long deallocations;
+    long long slabs;
+    long long reservedObjects;
+};
+
+//@ Classe que implementa um pool de objetos de tamanho fixo, alocados em blocos (slabs) e reaproveitados por listas livres
+//@ Cada thread tem um cache próprio por pool: alocar e liberar só mexem nesse cache (sem trava nem atômicos);
+//@ a lista livre global, protegida por mutex, só é usada para reabastecer ou esvaziar caches em lotes
+//@ Os slabs só são devolvidos ao sistema quando o pool é destruído
+class SlabPool {
+  public:
+    //@ Número máximo de pools no processo (cada pool ocupa uma entrada do cache das threads)
+    static constexpr int MAX_POOLS = 32;
+
+    //@ Objetos trocados entre um cache e a lista livre global de cada vez
+    static constexpr int BATCH_SIZE = 64;
+
+  private:
+    //@ Objeto livre (o próprio espaço do objeto guarda o próximo da lista)
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    //@ Cache de uma thread para um pool: lista livre local e contagens ainda não repassadas ao pool
+    //@ Trivial de propósito, para que o acesso thread_local não precise de inicialização dinâmica
+    struct LocalCache {
+        FreeNode* head;
+        int count;
+        long long allocations;
+        long long deallocations;
+    };
+
+    //@ Caches da thread corrente, indexados por pool
+    static thread_local LocalCache localCaches[MAX_POOLS];
+
+    //@ Nome do tipo (para as métricas), tamanho e alinhamento de cada objeto e objetos por slab
+    std::string name;
+    size_t objectSize;
+    size_t alignment;
+    int objectsPerSlab;
+
+    //@ Posição do pool no registro e em localCaches
+    int index;
+
+    //@ Lista livre global e slabs alocados (protegidos por mutex)
+    std::mutex mutex;
+    FreeNode* freeList;
+    void** slabs;
+    int numSlabs;
+    int slabsCapacity;
+
+    //@ Contagens repassadas pelos caches (threads encerradas, lotes devolvidos e a thread que consulta)
+    std::atomic<long long> allocations;
+    std::atomic<long long> deallocations;
+
+    //@ Reabastece o cache da thread corrente (da lista global ou de um slab novo) e retorna um objeto
+    void* refill();
+
+    //@ Devolve BATCH_SIZE objetos do cache da thread corrente para a lista global
+    void drain(LocalCache& cache) noexcept;
+
+    //@ Devolve todo o cache da thread corrente (objetos e contagens) ao pool
+    void flush(LocalCache& cache) noexcept;
+
+    //@ Garante que os caches da thread corrente sejam devolvidos quando ela terminar
+    static void registerThreadExit() noexcept;
+
+    friend struct SlabThreadExit;
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param name Nome do tipo nas métricas
+    //@ @param objectSize Tamanho de cada objeto
+    //@ @param alignment Alinhamento de cada objeto
+    //@ @param objectsPerSlab Objetos alocados de uma vez quando a lista livre se esgota
+    SlabPool(const std::string& name, size_t objectSize, size_t alignment = alignof(std::max_align_t), int objectsPerSlab = 256);
+    ~SlabPool();
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    //@ Função que retorna um objeto não inicializado do pool
+    void* allocate() {
+        LocalCache& cache = localCaches[index];
+        FreeNode* node = cache.head;
+        if (node == nullptr) {
+            return refill();
+        }
+        cache.head = node->next;
+        cache.count--;
+        cache.allocations++;
+        return node;
+    }
+
+    //@ Função que devolve ao pool um objeto obtido por allocate (de qualquer thread)
+    void deallocate(void* object) noexcept {
+        LocalCache& cache = localCaches[index];
+        if (cache.head == nullptr) {
+            //* Uma thread pode só liberar objetos (alocados por outra): o cache precisa ser devolvido quando ela terminar
+            registerThreadExit();
+        }
+        FreeNode* node = static_cast<FreeNode*>(object);
+        node->next = cache.head;
+        cache.head = node;
+        cache.count++;
+        cache.deallocations++;
+        if (cache.count > 2 * BATCH_SIZE) {
+            drain(cache);
+        }
+    }
+
+    //@ Função que retorna as estatísticas do pool
+    //@ Inclui as contagens da thread que consulta e das threads já encerradas (outras threads ativas entram ao terminar)
+    SlabPoolStats getStats();
+
+    //@ Funções que percorrem todos os pools criados no processo
+    static int getNumPools();
+    static SlabPoolStats getStats(int poolIndex);
+};
+
+//@ Função que retorna o pool compartilhado dos objetos do tipo T (criado no primeiro uso)
+template <typename T>
+SlabPool& slabPoolFor() {
+    static SlabPool pool(typeid(T).name(), sizeof(T), alignof(T));
+    return pool;
+}
+
+//@ Alocador no formato de std::allocator que obtém cada objeto do pool do seu tipo
+//@ Pedidos de um único objeto (nós de listas) vão para o pool; vetores vão para o heap global
+template <typename T>
+class SlabAllocator {
+  public:
+    typedef T value_type;
+
+    SlabAllocator() noexcept {}
+    template <typename U>
+    SlabAllocator(const SlabAllocator<U>&) noexcept {}
+
+    T* allocate(size_t count) {
+        if (count == 1) {
+            return static_cast<T*>(slabPoolFor<T>().allocate());
+        }
+        return static_cast<T*>(::operator new(count * sizeof(T)));
+    }
+
+    void deallocate(T* object, size_t count) noexcept {
+        if (count == 1) {
+            slabPoolFor<T>().deallocate(object);
+        } else {
+            ::operator delete(object);
+        }
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const SlabAllocator<T>&, const SlabAllocator<U>&) noexcept {
+    return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const SlabAllocator<T>&, const SlabAllocator<U>&) noexcept {
+    return false;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+//@ Classe que implementa um pool fixo de threads para laços paralelos (parallelFor)
+//@ A thread chamadora também executa iterações, como trabalhador de ID 0
+class ThreadPool {
+  private:
+    //@ Threads auxiliares (IDs de trabalhador 1..numWorkers)
+    std::thread* workers;
+    int numWorkers;
+
+    //@ Sincronização entre a thread chamadora e os trabalhadores
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+
+    //@ Tarefa corrente e intervalo de índices ainda não distribuídos
+    const std::function<void(int, int)>* task;
+    std::atomic<int> nextIndex;
+    int endIndex;
+
+    //@ Primeira exceção lançada pela tarefa corrente (relançada na thread chamadora ao fim do parallelFor)
+    std::exception_ptr firstError;
+
+    //@ Geração da tarefa corrente, trabalhadores pendentes e sinal de parada
+    int generation;
+    int pendingWorkers;
+    bool stopping;
+
+    //@ Laço principal de cada thread auxiliar
+    void workerLoop(int workerId);
+
+    //@ Consome índices da tarefa corrente até o intervalo acabar
+    void runTasks(int workerId);
+
+  public:
+    //@ Construtor e destrutor
+    //@ @param numThreads Total de threads (0 usa std::thread::hardware_concurrency)
+    ThreadPool(int numThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    //@ Função que retorna o total de threads, incluindo a chamadora
+    int getNumThreads() const noexcept;
+
+    //@ Executa body(índice, trabalhador) para todo índice em [begin, end) e espera o término
+    //@ O ID do trabalhador fica em [0, getNumThreads()) e serve para indexar buffers por thread
+    //@ Se body lançar, os índices ainda não distribuídos são descartados e a primeira exceção é relançada aqui,
+    //@ depois que todos os trabalhadores pararam
+    void parallelFor(int begin, int end, const std::function<void(int index, int workerId)>& body);
+};
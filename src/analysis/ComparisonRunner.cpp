@@ -37,26 +37,6 @@ bool generateSimpleConfig(int warehouses, int packages, const std::string& filen
     return ConfigGenerator::saveConfigToFile(config, filename);
 }
 
-// Simple routing for comparison when using GraphExtended
-LinkedList createSimpleRoute(int origin, int destination, GraphExtended* graph) {
-    LinkedList route;
-
-    if (graph && origin != destination) {
-        Route bestRoute = graph->findBestRoute(origin, destination, 1, 0);
-        if (bestRoute.path.getCurrentSize() > 0) {
-            return bestRoute.path;
-        }
-    }
-
-    // Fallback: direct route
-    route.addBack(origin);
-    if (origin != destination) {
-        route.addBack(destination);
-    }
-
-    return route;
-}
-
 std::vector<ComparisonResult> runComparison() {
     std::vector<ComparisonResult> results;
 
@@ -84,13 +64,9 @@ std::vector<ComparisonResult> runComparison() {
 
                 ConfigData baseData = loadInput(configFile);
 
-                // Calculate routes for base using basic routing
-                for (int i = 0; i < baseData.numPackages; ++i) {
-                    Package* pkg = baseData.packages[i];
-                    if (pkg) {
-                        LinkedList route = Routing::calculateOptimalRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(), *baseData.graph);
-                        pkg->setRoute(std::move(route));
-                    }
+                // Calculate routes for base using basic routing (one BFS tree per origin)
+                if (baseData.packageTable != nullptr) {
+                    Routing::calculateRoutes(*baseData.packageTable, *baseData.graph, *baseData.pool, baseData.routeTable);
                 }
 
                 Scheduler baseScheduler(baseData);
@@ -116,23 +92,9 @@ std::vector<ComparisonResult> runComparison() {
             try {
                 auto start = std::chrono::high_resolution_clock::now();
 
+                // The loader already routes every package in batch
                 ConfigDataExtended extData = loadInputExtended(configFile);
 
-                // Calculate routes for extended
-                for (int i = 0; i < extData.numPackages; ++i) {
-                    PackageExtended* pkg = extData.packages[i];
-                    if (pkg) {
-                        if (extData.multipleRoutes) {
-                            Route bestRoute = extData.graph->findBestRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(), pkg->getWeight(), 0);
-                            pkg->setRoute(std::move(bestRoute.path));
-                        } else {
-                            LinkedList route = createSimpleRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(), extData.graph);
-                            pkg->setRoute(std::move(route));
-                        }
-                        pkg->updateLastRouteCalculation(0);
-                    }
-                }
-
                 SchedulerExtended extScheduler(extData);
                 extScheduler.runSimulation(extData.warehouses, extData.graph, extData.numWarehouses);
 
@@ -147,8 +147,11 @@ int main() {
     // Cria diretório de resultados
     std::filesystem::create_directories("results");
 
-    // Gera configurações de teste
+    // Gera configurações de teste; cada arquivo é carregado em todas as rodadas abaixo, então as rotas
+    // de todos os pares são calculadas uma vez aqui e mapeadas de <arquivo>.rt nas cargas
     generateConfigFiles();
+    SimulationMetrics::prepareRouteTable("configs/base_config.txt");
+    SimulationMetrics::prepareRouteTable("configs/extended_config.txt", true);
 
     std::cout << "\n1. Teste com configuração simples..." << std::endl;
     auto results1 = runComparison("configs/base_config.txt", "configs/extended_config.txt");
@@ -1,7 +1,9 @@
 #include "../../include/analysis/SimulationMetrics.h"
 #include "../../include/analysis/ConfigGenerator.h"
 #include "../../include/core/ConfigData.h"
+#include "../../include/core/ConfigDataExtended.h"
 #include "../../include/core/Scheduler.h"
+#include "../../include/dataStructures/RouteTable.h"
 #include "../../include/domains/Package.h"
 #include "../../include/domains/Warehouse.h"
 #include <algorithm>
@@ -22,11 +24,22 @@ SimulationMetrics::SimulationMetrics() : rearrangementCount(0), transportEventCo
 }
 
 void SimulationMetrics::startTimer() {
+    allocationsAtStart = captureAllocationStats();
     startTime = std::chrono::high_resolution_clock::now();
 }
 
 void SimulationMetrics::stopTimer() {
     endTime = std::chrono::high_resolution_clock::now();
+    allocationsAtStop = captureAllocationStats();
+}
+
+std::vector<SlabPoolStats> SimulationMetrics::captureAllocationStats() {
+    std::vector<SlabPoolStats> stats;
+    int numPools = SlabPool::getNumPools();
+    for (int i = 0; i < numPools; ++i) {
+        stats.push_back(SlabPool::getStats(i));
+    }
+    return stats;
 }
 
 void SimulationMetrics::recordRearrangement() {
@@ -71,14 +84,15 @@ SimulationMetrics::Metrics SimulationMetrics::calculateMetrics(const ConfigData&
     int actualDelivered = 0;
     double totalDeliveryTime = 0;
 
-    for (int i = 0; i < config.numPackages; ++i) {
-        Package* pkg = config.packages[i];
-        if (pkg != nullptr && pkg->getState() == PackageState::DELIVERED) {
-            actualDelivered++;
-            // Calcula tempo de entrega real (tempo final - tempo de postagem)
-            if (!deliveryTimes.empty() && static_cast<size_t>(i) < deliveryTimes.size()) {
-                totalDeliveryTime += (deliveryTimes[i] - pkg->getPostTime());
-            }
+    const PackageTable* table = config.packageTable;
+    if (table != nullptr) {
+        // Varre as colunas da tabela (a linha i é o pacote i): um byte de estado e uma postagem por pacote
+        actualDelivered = table->countInState(PackageState::DELIVERED);
+        const std::uint8_t* states = table->getStates();
+        const std::int32_t* postTimes = table->getPostTimes();
+        int numTimes = static_cast<int>(std::min(deliveryTimes.size(), static_cast<size_t>(table->getSize())));
+        for (int i = 0; i < numTimes; ++i) {
+            totalDeliveryTime += states[i] == PackageState::DELIVERED ? deliveryTimes[i] - postTimes[i] : 0.0;
         }
     }
 
@@ -118,10 +132,17 @@ SimulationMetrics::Metrics SimulationMetrics::calculateMetrics(const ConfigData&
     metrics.totalEvents = rearrangementCount + transportEventCount;
     metrics.packagesInTransit = config.numPackages - metrics.deliveredPackages;
 
+    // Alocações por tipo durante a medição (pools criados depois de startTimer partem de zero)
+    metrics.allocationStats = allocationsAtStop;
+    for (size_t i = 0; i < metrics.allocationStats.size() && i < allocationsAtStart.size(); ++i) {
+        metrics.allocationStats[i].allocations -= allocationsAtStart[i].allocations;
+        metrics.allocationStats[i].deallocations -= allocationsAtStart[i].deallocations;
+    }
+
     return metrics;
 }
 
-SimulationMetrics::Metrics SimulationMetrics::runSimulationWithMetrics(const std::string& configFile) {
+SimulationMetrics::Metrics SimulationMetrics::runSimulationWithMetrics(const std::string& configFile, StoragePolicy storagePolicy) {
     ConfigData data = {};
     SimulationMetrics metrics;
     g_metrics = &metrics; // Set global pointer for logging functions to use
@@ -131,10 +152,10 @@ SimulationMetrics::Metrics SimulationMetrics::runSimulationWithMetrics(const std
         metrics.startTimer();
 
         std::cout << "Loading config: " << configFile << std::endl;
-        data = loadInput(configFile);
+        data = loadInput(configFile, INPUT_ORDER, false, storagePolicy);
 
         // Verifica se dados foram carregados corretamente
-        if (data.packages == nullptr && data.numPackages > 0) {
+        if (data.packageTable == nullptr && data.numPackages > 0) {
             std::cerr << "Erro: Pacotes não foram carregados corretamente" << std::endl;
             cleanup(data);
             g_metrics = nullptr;
@@ -150,12 +171,10 @@ SimulationMetrics::Metrics SimulationMetrics::runSimulationWithMetrics(const std
 
         std::cout << "Loaded " << data.numPackages << " packages, " << data.numWarehouses << " warehouses" << std::endl;
 
-        // Calcula rotas otimais (parte da medição)
-        for (int i = 0; i < data.numPackages; ++i) {
-            Package* pkg = data.packages[i];
-            if (pkg != nullptr) {
-                LinkedList route = Routing::calculateOptimalRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(), *data.graph);
-                pkg->setRoute(std::move(route));
+        // Calcula rotas otimais em lote, uma BFS por origem (parte da medição)
+        if (data.packageTable != nullptr) {
+            Routing::calculateRoutes(*data.packageTable, *data.graph, *data.pool, data.routeTable);
+            for (int i = 0; i < data.packageTable->getSize(); ++i) {
                 metrics.recordProcessingOperation(); // Conta operações de processamento
             }
         }
@@ -181,13 +200,7 @@ SimulationMetrics::Metrics SimulationMetrics::runSimulationWithMetrics(const std
         metrics.updateMaxOccupancy(totalOccupancy);
 
         // Count delivered packages by checking their state
-        int deliveredCount = 0;
-        for (int i = 0; i < data.numPackages; ++i) {
-            Package* pkg = data.packages[i];
-            if (pkg != nullptr && pkg->getState() == PackageState::DELIVERED) {
-                deliveredCount++;
-            }
-        }
+        int deliveredCount = data.packageTable != nullptr ? data.packageTable->countInState(PackageState::DELIVERED) : 0;
 
         std::cout << "Delivered " << deliveredCount << " out of " << data.numPackages << " packages" << std::endl;
         std::cout << "Rearrangements: " << metrics.rearrangementCount << std::endl;
@@ -203,6 +216,9 @@ SimulationMetrics::Metrics SimulationMetrics::runSimulationWithMetrics(const std
     }
 
     auto result = metrics.calculateMetrics(data);
+    for (const SlabPoolStats& pool : result.allocationStats) {
+        std::cout << "Allocations (" << pool.name << "): " << pool.allocations << ", slabs: " << pool.slabs << " x " << pool.objectSize << " bytes" << std::endl;
+    }
     cleanup(data);
     g_metrics = nullptr;
     return result;
@@ -344,6 +360,63 @@ SimulationMetrics::ExperimentResult SimulationMetrics::runTransportContentionExp
     return result;
 }
 
+SimulationMetrics::ExperimentResult SimulationMetrics::runStoragePolicyExperiment() {
+    ExperimentResult result;
+    result.experimentName = "Disciplinas de Armazenamento sob Contenção";
+
+    // Mesmo cenário (contenção máxima) para todas as disciplinas
+    auto configs = ConfigGenerator::generateTransportContentionVariations(10, 300);
+    std::filesystem::remove_all("results/storage_policy");
+
+    std::error_code ec;
+    std::filesystem::create_directories("results/storage_policy", ec);
+    if (ec) {
+        std::cerr << "Erro ao criar diretório: " << ec.message() << std::endl;
+        return result;
+    }
+
+    std::string filename = "results/storage_policy/" + configs.front().description + ".txt";
+    if (!ConfigGenerator::saveConfigToFile(configs.front(), filename)) {
+        std::cerr << "Failed to save config file: " << filename << std::endl;
+        return result;
+    }
+
+    // As quatro execuções carregam a mesma topologia: a tabela de rotas é calculada uma vez, fora da medição
+    prepareRouteTable(filename);
+
+    const StoragePolicy policies[] = {LIFO_STORAGE, FIFO_STORAGE, AGE_PRIORITY_STORAGE, WEIGHT_ORDERED_STORAGE};
+    for (StoragePolicy policy : policies) {
+        std::cout << "\n=== Testing storage policy: " << storagePolicyName(policy) << " ===" << std::endl;
+        auto metrics = runSimulationWithMetrics(filename, policy);
+
+        result.inputSizes.push_back(policy);
+        result.executionTimes.push_back(metrics.executionTimeMs);
+        result.allMetrics.push_back(metrics);
+
+        std::cout << "RESULT - Disciplina: " << storagePolicyName(policy) << ", Rearmazenamentos: " << metrics.totalRearrangements << ", Pacotes entregues: " << metrics.deliveredPackages << "/"
+                  << metrics.totalPackages << ", Tempo médio de entrega: " << metrics.averageDeliveryTime << ", Throughput: " << metrics.throughput << std::endl;
+    }
+
+    return result;
+}
+
+bool SimulationMetrics::prepareRouteTable(const std::string& configFile, bool extended) {
+    RouteTable* table = nullptr;
+    try {
+        table = extended ? buildRouteTableExtended(configFile) : buildRouteTable(configFile);
+    } catch (const std::exception& e) {
+        std::cerr << "Aviso: tabela de rotas de " << configFile << " não calculada: " << e.what() << std::endl;
+        return false;
+    }
+
+    bool saved = table->saveToFile(configFile + ".rt");
+    delete table;
+    if (!saved) {
+        std::cerr << "Aviso: não foi possível salvar a tabela de rotas em " << configFile << ".rt" << std::endl;
+    }
+    return saved;
+}
+
 void SimulationMetrics::saveResultsToCSV(const ExperimentResult& results, const std::string& filename) {
     // Remove arquivo antigo se existir
     std::remove(filename.c_str());
@@ -12,22 +12,46 @@
 //@ Função principal do programa
 int main(int argc, char* argv[]) {
     if (argc < 2) {
-        std::cerr << "Uso: " << argv[0] << " <arquivo_de_entrada>" << std::endl;
+        std::cerr << "Uso: " << argv[0] << " <arquivo_de_entrada> [--ordem=bfs|rcm] [--rotas=sob-demanda] [--paginas-grandes] [--armazenamento=lifo|fifo|idade|peso]" << std::endl;
         return 1;
     }
 
     std::string inputFilename = argv[1];
+
+    //* Renumeração opcional dos armazéns para melhorar a localidade; a saída não muda
+    //* Roteamento sob demanda: cada rota é calculada na postagem do pacote; a saída também não muda
+    //* Páginas grandes: a região de pacotes e armazéns é mapeada em páginas de 2 MiB, quando o sistema permite
+    //* Armazenamento: disciplina das seções (ver StoragePolicy); fora de lifo a saída muda, pois menos pacotes são rearmazenados
+    WarehouseOrdering ordering = INPUT_ORDER;
+    bool lazyRouting = false;
+    bool hugePages = false;
+    StoragePolicy storagePolicy = LIFO_STORAGE;
+    for (int i = 2; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "--ordem=bfs") {
+            ordering = BFS_ORDER;
+        } else if (option == "--ordem=rcm") {
+            ordering = RCM_ORDER;
+        } else if (option == "--rotas=sob-demanda") {
+            lazyRouting = true;
+        } else if (option == "--paginas-grandes") {
+            hugePages = true;
+        } else if (option.compare(0, 16, "--armazenamento=") == 0 && parseStoragePolicy(option.substr(16), storagePolicy)) {
+            continue;
+        } else {
+            std::cerr << "Opcao desconhecida: " << option << std::endl;
+            return 1;
+        }
+    }
+
     ConfigData data = {};
 
     try {
-        data = loadInput(inputFilename);
-
-        for (int i = 0; i < data.numPackages; ++i) {
-            Package* pkg = data.packages[i];
-            if (pkg) {
-                LinkedList route = Routing::calculateOptimalRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(), *data.graph);
-                pkg->setRoute(std::move(route));
-            }
+        data = loadInput(inputFilename, ordering, hugePages, storagePolicy);
+        data.lazyRouting = lazyRouting;
+
+        if (!data.lazyRouting && data.packageTable != nullptr) {
+            Routing::calculateRoutes(*data.packageTable, *data.graph, *data.pool, data.routeTable);
         }
 
         Scheduler scheduler(data);
@@ -39,47 +39,12 @@ int main(int argc, char* argv[]) {
         std::cout << "- Capacidade de armazenamento limitada: " << (data.limitedStorageCapacity ? "SIM" : "NÃO") << std::endl;
         std::cout << "- Múltiplas rotas: " << (data.multipleRoutes ? "SIM" : "NÃO") << std::endl;
         std::cout << "- Roteamento dinâmico: " << (data.dynamicRouting ? "SIM" : "NÃO") << std::endl;
+        std::cout << "- Hierarquia de contração: " << (data.contractionHierarchy ? "SIM" : "NÃO") << std::endl;
+        std::cout << "- Roteamento dependente do tempo: " << (data.timeDependentRouting ? "SIM" : "NÃO") << std::endl;
+        std::cout << "- Roteamento sob demanda: " << (data.lazyRouting ? "SIM" : "NÃO") << std::endl;
+        std::cout << "- Capacidade adaptativa: " << (data.adaptiveCapacity ? "SIM" : "NÃO") << std::endl;
         std::cout << std::endl;
 
-        // Calcula rotas iniciais para todos os pacotes
-        std::cout << "Calculando rotas iniciais..." << std::endl;
-        for (int i = 0; i < data.numPackages; ++i) {
-            PackageExtended* pkg = data.packages[i];
-            if (pkg) {
-                if (data.multipleRoutes) {
-                    // Usa o algoritmo avançado de roteamento do GraphExtended
-                    Route bestRoute = data.graph->findBestRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(), pkg->getWeight(), 0);
-                    pkg->setRoute(std::move(bestRoute.path));
-                } else {
-                    // Para compatibilidade, usa roteamento simples baseado na topologia
-                    // Implementa um Dijkstra básico usando as estruturas do GraphExtended
-                    LinkedList route;
-
-                    // Adiciona origem e destino como rota direta para casos simples
-                    route.addBack(pkg->getInitialOrigin());
-
-                    // Se origem != destino, precisa encontrar caminho
-                    if (pkg->getInitialOrigin() != pkg->getFinalDestination()) {
-                        // Usa o método findBestRoute do GraphExtended mesmo sem múltiplas rotas
-                        Route simpleRoute = data.graph->findBestRoute(pkg->getInitialOrigin(), pkg->getFinalDestination(),
-                                                                      1, // peso padrão
-                                                                      0  // tempo inicial
-                        );
-
-                        if (simpleRoute.path.getCurrentSize() > 0) {
-                            route = simpleRoute.path;
-                        } else {
-                            // Fallback: adiciona destino diretamente se não encontrar rota
-                            route.addBack(pkg->getFinalDestination());
-                        }
-                    }
-
-                    pkg->setRoute(std::move(route));
-                }
-                pkg->updateLastRouteCalculation(0);
-            }
-        }
-
         std::cout << "Iniciando simulação estendida..." << std::endl;
         SchedulerExtended scheduler(data);
         scheduler.runSimulation(data.warehouses, data.graph, data.numWarehouses);
@@ -93,6 +58,9 @@ int main(int argc, char* argv[]) {
         std::cout << "Overflows de capacidade: " << capOverflow << std::endl;
         std::cout << "Overflows de peso: " << weightOverflow << std::endl;
         std::cout << "Rotas alternativas usadas: " << altRoutes << std::endl;
+        if (scheduler.getUndeliverablePackages() > 0) {
+            std::cout << "Pacotes sem rota (descartados): " << scheduler.getUndeliverablePackages() << std::endl;
+        }
 
         // Calcula métricas de eficiência
         if (data.limitedStorageCapacity) {
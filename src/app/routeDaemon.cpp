@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../include/core/ConfigDataExtended.h"
+#include "../../include/core/RouteDaemon.h"
+#include "../../include/dataStructures/GraphExtended.h"
+#include "../../include/dataStructures/RouteService.h"
+
+namespace {
+
+//@ Servidor ativo, para o tratador de sinais
+RouteDaemon* activeDaemon = nullptr;
+
+void handleSignal(int) {
+    if (activeDaemon != nullptr) {
+        activeDaemon->requestStop();
+    }
+}
+
+//@ Imprime p50, p90, p99, máximo e média em microssegundos
+void printStats(const char* label, int64_t count, const int64_t stats[RouteProtocol::NUM_STATS]) {
+    std::cout << label << ": " << count << " consultas, p50 " << stats[0] << " us, p90 " << stats[1] << " us, p99 " << stats[2] << " us, max " << stats[3] << " us, media " << stats[4] << " us"
+              << std::endl;
+}
+
+//@ Modo servidor: carrega só a topologia (sem pacotes nem rotas iniciais) e atende até SHUTDOWN ou SIGINT/SIGTERM
+int runServer(const std::string& configFile, const std::string& socketPath, int numThreads) {
+    ConfigDataExtended data = loadTopologyExtended(configFile);
+    if (data.graph == nullptr) {
+        std::cerr << "Nao foi possivel carregar a topologia de " << configFile << std::endl;
+        return 1;
+    }
+
+    int status = 0;
+    try {
+        RouteService service(*data.graph, numThreads);
+        RouteDaemon daemon(service, socketPath, service.getNumWorkers());
+        activeDaemon = &daemon;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+
+        std::cout << "Servidor de rotas em " << socketPath << " (" << service.getNumVertices() << " armazens, " << service.getNumWorkers() << " threads)" << std::endl;
+        daemon.run();
+        activeDaemon = nullptr;
+
+        int64_t stats[RouteProtocol::NUM_STATS];
+        daemon.getLatencyStats(stats);
+        printStats("Latencia no servidor", daemon.getNumQueries(), stats);
+    } catch (const std::exception& e) {
+        activeDaemon = nullptr;
+        std::cerr << "Ocorreu um erro fatal: " << e.what() << std::endl;
+        status = 1;
+    }
+
+    cleanupExtended(data);
+    return status;
+}
+
+//@ Modo cliente: lê consultas "origem destino peso tempo" da entrada padrão, envia em quadros de batchSize
+//@ sem esperar respostas (pipeline) e imprime as rotas e os percentis de ida e volta por consulta
+int runClient(const std::string& socketPath, int batchSize, bool shutdownServer) {
+    std::vector<RouteProtocol::Query> queries;
+    RouteProtocol::Query query;
+    while (std::cin >> query.origin >> query.destination >> query.weight >> query.time) {
+        queries.push_back(query);
+    }
+
+    RouteClient client(socketPath);
+    int numFrames = (static_cast<int>(queries.size()) + batchSize - 1) / batchSize;
+    std::vector<std::chrono::steady_clock::time_point> sentAt(numFrames);
+
+    //* Envio e recepção em threads separadas: o servidor pode responder antes de todo o envio terminar
+    //* Uma falha em um lado interrompe a conexão, para o outro não ficar bloqueado, e é relançada após o join
+    std::exception_ptr sendError;
+    std::thread sender([&]() {
+        try {
+            for (int f = 0; f < numFrames; ++f) {
+                int first = f * batchSize;
+                int count = std::min(batchSize, static_cast<int>(queries.size()) - first);
+                sentAt[f] = std::chrono::steady_clock::now();
+                client.sendQueries(queries.data() + first, static_cast<uint32_t>(count));
+            }
+        } catch (...) {
+            sendError = std::current_exception();
+            client.abort();
+        }
+    });
+
+    std::exception_ptr receiveError;
+    std::vector<int64_t> roundTrips;
+    std::vector<std::vector<int>> routes;
+    try {
+        for (int f = 0; f < numFrames; ++f) {
+            client.receiveRoutes(routes);
+            auto now = std::chrono::steady_clock::now();
+            int64_t elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - sentAt[f]).count();
+
+            int first = f * batchSize;
+            for (size_t i = 0; i < routes.size(); ++i) {
+                const RouteProtocol::Query& q = queries[first + i];
+                std::cout << q.origin << " " << q.destination << " " << q.weight << " " << q.time << ": " << routes[i][0];
+                for (size_t k = 1; k < routes[i].size(); ++k) {
+                    std::cout << (k == 1 ? " [" : " ") << routes[i][k];
+                }
+                std::cout << (routes[i].size() > 1 ? "]" : "") << std::endl;
+                roundTrips.push_back(elapsed);
+            }
+        }
+    } catch (...) {
+        receiveError = std::current_exception();
+        client.abort();
+    }
+    sender.join();
+
+    // O erro de envio é a causa; o de recepção, nesse caso, é só a conexão interrompida
+    if (sendError) {
+        std::rethrow_exception(sendError);
+    }
+    if (receiveError) {
+        std::rethrow_exception(receiveError);
+    }
+
+    int64_t stats[RouteProtocol::NUM_STATS] = {0, 0, 0, 0, 0};
+    if (!roundTrips.empty()) {
+        std::sort(roundTrips.begin(), roundTrips.end());
+        size_t last = roundTrips.size() - 1;
+        stats[0] = roundTrips[static_cast<size_t>(0.50 * last + 0.5)];
+        stats[1] = roundTrips[static_cast<size_t>(0.90 * last + 0.5)];
+        stats[2] = roundTrips[static_cast<size_t>(0.99 * last + 0.5)];
+        stats[3] = roundTrips.back();
+        int64_t total = 0;
+        for (int64_t value : roundTrips) {
+            total += value;
+        }
+        stats[4] = total / static_cast<int64_t>(roundTrips.size());
+    }
+    printStats("Ida e volta no cliente", static_cast<int64_t>(roundTrips.size()), stats);
+
+    int64_t count = client.requestStats(stats);
+    printStats("Latencia no servidor", count, stats);
+
+    if (shutdownServer) {
+        client.requestShutdown();
+    }
+    return 0;
+}
+
+} // namespace
+
+//@ Função principal do servidor de rotas
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Uso: " << argv[0] << " <arquivo_de_entrada> <socket> [threads]" << std::endl;
+        std::cerr << "     " << argv[0] << " --cliente <socket> [consultas_por_quadro] [--encerrar] < consultas" << std::endl;
+        std::cerr << "Cada consulta é uma linha \"origem destino peso tempo\"" << std::endl;
+        return 1;
+    }
+
+    try {
+        if (std::string(argv[1]) == "--cliente") {
+            int batchSize = 64;
+            bool shutdownServer = false;
+            for (int i = 3; i < argc; ++i) {
+                std::string option = argv[i];
+                if (option == "--encerrar") {
+                    shutdownServer = true;
+                } else {
+                    batchSize = std::max(1, std::stoi(option));
+                }
+            }
+            return runClient(argv[2], batchSize, shutdownServer);
+        }
+
+        int numThreads = argc >= 4 ? std::stoi(argv[3]) : 0;
+        return runServer(argv[1], argv[2], numThreads);
+    } catch (const std::exception& e) {
+        std::cerr << "Ocorreu um erro fatal: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,62 @@
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "../../include/core/ConfigData.h"
+#include "../../include/core/ConfigDataExtended.h"
+#include "../../include/dataStructures/RouteTable.h"
+
+//@ Ferramenta que pré-calcula as rotas de todos os pares de uma topologia e as salva em <entrada>.rt,
+//@ arquivo que os carregadores mapeiam nas execuções seguintes em vez de recalcular as rotas
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0] << " <arquivo_de_entrada> [--estendido] [--ordem=bfs|rcm] [--threads=N] [--saida=arquivo]" << std::endl;
+        return 1;
+    }
+
+    std::string inputFile = argv[1];
+    std::string outputFile = inputFile + ".rt";
+    bool extended = false;
+    WarehouseOrdering ordering = INPUT_ORDER;
+    int numThreads = 0;
+
+    try {
+        for (int i = 2; i < argc; ++i) {
+            std::string option = argv[i];
+            if (option == "--estendido") {
+                extended = true;
+            } else if (option == "--ordem=bfs") {
+                ordering = BFS_ORDER;
+            } else if (option == "--ordem=rcm") {
+                ordering = RCM_ORDER;
+            } else if (option.rfind("--threads=", 0) == 0) {
+                numThreads = std::stoi(option.substr(10));
+            } else if (option.rfind("--saida=", 0) == 0) {
+                outputFile = option.substr(8);
+            } else {
+                std::cerr << "Opcao desconhecida: " << option << std::endl;
+                return 1;
+            }
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        RouteTable* table = extended ? buildRouteTableExtended(inputFile, numThreads) : buildRouteTable(inputFile, ordering, numThreads);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        bool saved = table->saveToFile(outputFile);
+        std::cout << "Tabela de rotas: " << table->getNumVertices() << " armazens, " << table->getNumLayers() << " peso(s), "
+                  << std::chrono::duration<double, std::milli>(end - start).count() << " ms" << std::endl;
+        delete table;
+
+        if (!saved) {
+            std::cerr << "Nao foi possivel salvar a tabela de rotas em " << outputFile << std::endl;
+            return 1;
+        }
+        std::cout << "Salva em " << outputFile << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Ocorreu um erro fatal: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,11 +1,17 @@
 #include "../../include/core/ConfigData.h"
+#include "../../include/dataStructures/RouteArena.h"
+#include "../../include/dataStructures/RouteTable.h"
 #include "../../include/domains/Package.h"
+#include "../../include/domains/PackageTable.h"
 #include "../../include/domains/Warehouse.h"
+#include "../../include/utils/RegionArena.h"
+#include "../../include/utils/ThreadPool.h"
+#include <algorithm>
 #include <fstream>
 #include <stdexcept>
 #include <string>
 
-ConfigData::ConfigData() : transportCapacity(0), transportLatency(0), transportInterval(0), removalCost(0), numWarehouses(0), numPackages(0), graph(nullptr), warehouses(nullptr), packages(nullptr) {}
+ConfigData::ConfigData() : transportCapacity(0), transportLatency(0), transportInterval(0), removalCost(0), numWarehouses(0), numPackages(0), graph(nullptr), warehouses(nullptr), packageTable(nullptr), routes(nullptr), pool(nullptr), routeTable(nullptr), lazyRouting(false), storagePolicy(LIFO_STORAGE), externalIds(nullptr), arena(nullptr) {}
 
 //@ Funções auxiliares para leitura do arquivo de entrada
 void readGeneralConfig(std::ifstream& file, ConfigData& data) {
@@ -22,10 +28,6 @@ void readWarehouseAndGraphData(std::ifstream& file, ConfigData& data) {
     }
 
     data.graph = new Graph(data.numWarehouses);
-    data.warehouses = new Warehouse*[data.numWarehouses];
-    for (int i = 0; i < data.numWarehouses; ++i) {
-        data.warehouses[i] = new Warehouse(i, data.numWarehouses);
-    }
 
     for (int i = 0; i < data.numWarehouses; ++i) {
         for (int j = 0; j < data.numWarehouses; ++j) {
@@ -41,17 +43,59 @@ void readWarehouseAndGraphData(std::ifstream& file, ConfigData& data) {
     }
 }
 
-void readPackageData(std::ifstream& file, ConfigData& data) {
+//@ Renumera os armazéns segundo a ordenação escolhida, reconstruindo o grafo
+//@ Retorna o novo ID de cada ID original (nullptr se a ordem do arquivo for mantida)
+int* applyWarehouseOrdering(ConfigData& data, WarehouseOrdering ordering) {
+    if (ordering == INPUT_ORDER) {
+        return nullptr;
+    }
+
+    int n = data.numWarehouses;
+    int* order = computeWarehouseOrder(*data.graph, ordering);
+    int* internalId = new int[n];
+    for (int k = 0; k < n; ++k) {
+        internalId[order[k]] = k;
+    }
+
+    //* Os vizinhos continuam em ordem de ID original, preservando o desempate das BFS de roteamento
+    Graph* renumbered = new Graph(n);
+    renumbered->setNeighborOrder(order);
+    for (int k = 0; k < n; ++k) {
+        for (int neighbor : data.graph->neighbors(order[k])) {
+            if (k < internalId[neighbor]) {
+                renumbered->addEdge(k, internalId[neighbor], data.transportCapacity);
+            }
+        }
+    }
+    delete data.graph;
+    data.graph = renumbered;
+
+    //* Os armazéns ainda não foram criados: o armazém de índice k terá ID k
+    data.externalIds = data.arena->allocateArray<int>(n);
+    std::copy(order, order + n, data.externalIds);
+    delete[] order;
+    return internalId;
+}
+
+//@ Cria os armazéns, cada um com seções só para os seus vizinhos (por isso depois da renumeração)
+void createWarehouses(ConfigData& data) {
+    data.warehouses = data.arena->allocateArray<Warehouse*>(data.numWarehouses);
+    for (int i = 0; i < data.numWarehouses; ++i) {
+        data.warehouses[i] = data.arena->create<Warehouse>(i, data.numWarehouses, data.graph->neighbors(i), data.arena, data.storagePolicy);
+    }
+}
+
+void readPackageData(std::ifstream& file, ConfigData& data, const int* internalId) {
     file >> data.numPackages;
     if (file.fail() || data.numPackages < 0) {
         throw std::runtime_error("Erro ao ler numero de pacotes ou numero invalido.");
     }
     if (data.numPackages == 0) {
-        data.packages = nullptr;
+        data.packageTable = nullptr;
         return;
     }
 
-    data.packages = new Package*[data.numPackages];
+    data.packageTable = data.arena->create<PackageTable>(data.numPackages, *data.routes, data.arena);
     std::string trash;
 
     for (int i = 0; i < data.numPackages; ++i) {
@@ -64,54 +108,149 @@ void readPackageData(std::ifstream& file, ConfigData& data) {
             throw std::runtime_error("Origem ou destino invalido para o pacote " + std::to_string(i));
         }
 
-        data.packages[i] = new Package(i, origin, destination, postTime);
+        if (internalId != nullptr) {
+            origin = internalId[origin];
+            destination = internalId[destination];
+        }
+        data.packageTable->add(i, origin, destination, postTime);
     }
 }
 
-ConfigData loadInput(const std::string& filename) {
+ConfigData loadInput(const std::string& filename, WarehouseOrdering ordering, bool hugePages, StoragePolicy storagePolicy) {
     std::ifstream file(filename);
     if (!file.is_open()) {
         throw std::runtime_error("Nao foi possivel abrir o arquivo de entrada: " + filename);
     }
 
     ConfigData data;
+    int* internalId = nullptr;
 
     try {
+        data.arena = new RegionArena(hugePages);
+        data.routes = data.arena->create<RouteArena>();
+        data.pool = data.arena->create<ThreadPool>();
+        data.storagePolicy = storagePolicy;
         readGeneralConfig(file, data);
         readWarehouseAndGraphData(file, data);
-        readPackageData(file, data);
+        internalId = applyWarehouseOrdering(data, ordering);
+        createWarehouses(data);
+        readPackageData(file, data, internalId);
+        data.routeTable = RouteTable::loadFromFile(filename + ".rt", RouteTable::computeTopologyHash(*data.graph));
     } catch (const std::exception& e) {
+        delete[] internalId;
         file.close();
+        cleanup(data);
         throw;
     }
 
+    delete[] internalId;
+
     file.close();
     return data;
 }
 
+RouteTable* buildRouteTable(const std::string& filename, WarehouseOrdering ordering, int numThreads) {
+    ConfigData data = loadInput(filename, ordering);
+    RouteTable* table = nullptr;
+    try {
+        table = RouteTable::build(*data.graph, numThreads);
+    } catch (...) {
+        cleanup(data);
+        throw;
+    }
+    cleanup(data);
+    return table;
+}
+
 void cleanup(ConfigData& data) {
     if (data.graph) {
         delete data.graph;
         data.graph = nullptr;
     }
-    if (data.warehouses) {
-        for (int i = 0; i < data.numWarehouses; ++i) {
-            delete data.warehouses[i];
-        }
-        delete[] data.warehouses;
-        data.warehouses = nullptr;
-    }
-    if (data.packages) {
-        for (int i = 0; i < data.numPackages; ++i) {
-            delete data.packages[i];
-        }
-        delete[] data.packages;
-        data.packages = nullptr;
-    }
+    //* Pacotes, armazéns e suas seções estão todos na região: uma única liberação, sem percorrê-los
+    delete data.arena;
+    data.arena = nullptr;
+    data.warehouses = nullptr;
+    data.packageTable = nullptr;
+    data.routes = nullptr;
+    data.pool = nullptr;
+    delete data.routeTable;
+    data.routeTable = nullptr;
+    data.lazyRouting = false;
+    data.storagePolicy = LIFO_STORAGE;
     data.transportCapacity = 0;
     data.transportLatency = 0;
     data.transportInterval = 0;
     data.removalCost = 0;
     data.numWarehouses = 0;
     data.numPackages = 0;
+    data.externalIds = nullptr;
+}
+
+int* computeWarehouseOrder(const Graph& graph, WarehouseOrdering ordering) {
+    int n = graph.getNumWarehouses();
+    int* order = new int[n];
+    bool* visited = new bool[n];
+    int* degree = new int[n];
+    for (int v = 0; v < n; ++v) {
+        order[v] = v;
+        visited[v] = false;
+        degree[v] = graph.neighbors(v).size();
+    }
+    if (ordering == INPUT_ORDER) {
+        delete[] visited;
+        delete[] degree;
+        return order;
+    }
+
+    //* order também serve de fila: cada componente é acrescentada ao final conforme é descoberta
+    int tail = 0;
+    while (tail < n) {
+        // BFS parte do menor ID ainda não visitado; Cuthill-McKee parte do vértice de menor grau
+        int start = -1;
+        for (int v = 0; v < n; ++v) {
+            if (!visited[v] && (start == -1 || (ordering == RCM_ORDER && degree[v] < degree[start]))) {
+                start = v;
+            }
+        }
+
+        int head = tail;
+        visited[start] = true;
+        order[tail++] = start;
+        while (head < tail) {
+            int current = order[head++];
+            int firstNew = tail;
+            for (int neighbor : graph.neighbors(current)) {
+                if (!visited[neighbor]) {
+                    visited[neighbor] = true;
+                    order[tail++] = neighbor;
+                }
+            }
+
+            // Cuthill-McKee enfileira os vizinhos em ordem crescente de grau
+            if (ordering == RCM_ORDER) {
+                for (int k = firstNew + 1; k < tail; ++k) {
+                    int vertex = order[k];
+                    int m = k;
+                    while (m > firstNew && degree[order[m - 1]] > degree[vertex]) {
+                        order[m] = order[m - 1];
+                        m--;
+                    }
+                    order[m] = vertex;
+                }
+            }
+        }
+    }
+
+    if (ordering == RCM_ORDER) {
+        for (int i = 0, j = n - 1; i < j; ++i, --j) {
+            int temp = order[i];
+            order[i] = order[j];
+            order[j] = temp;
+        }
+    }
+
+    delete[] visited;
+    delete[] degree;
+    return order;
 }
\ No newline at end of file
@@ -1,25 +1,84 @@
 #include "../../include/core/ConfigDataExtended.h"
 #include "../../include/dataStructures/GraphExtended.h"
+#include "../../include/dataStructures/RouteArena.h"
+#include "../../include/dataStructures/RouteTable.h"
 #include "../../include/domains/PackageExtended.h"
 #include "../../include/domains/WarehouseExtended.h"
+#include "../../include/utils/RegionArena.h"
+#include "../../include/utils/ThreadPool.h"
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <random>
 #include <sstream>
+#include <stdexcept>
+#include <vector>
 
 ConfigDataExtended::ConfigDataExtended()
     : transportCapacity(0), transportLatency(0), transportInterval(0), removalCost(0), numWarehouses(0), numPackages(0), variableTransportTime(false), variablePackageWeight(false),
-      variableTransportCapacity(false), limitedStorageCapacity(false), multipleRoutes(false), dynamicRouting(false), graph(nullptr), warehouses(nullptr), packages(nullptr) {}
+      variableTransportCapacity(false), limitedStorageCapacity(false), multipleRoutes(false), dynamicRouting(false), contractionHierarchy(false), timeDependentRouting(false), lazyRouting(false), hugePages(false), adaptiveCapacity(false), maxAlternativeRoutes(3), storagePolicy(LIFO_STORAGE), graph(nullptr), warehouses(nullptr), packageTable(nullptr), routes(nullptr), pool(nullptr), edgeChanges(nullptr), numEdgeChanges(0), routeTable(nullptr), arena(nullptr) {}
 
-ConfigDataExtended loadInputExtended(const std::string& filename) {
-    ConfigDataExtended config;
-    std::ifstream file(filename);
+namespace {
 
-    if (!file.is_open()) {
-        std::cerr << "Erro ao abrir arquivo: " << filename << std::endl;
-        return config;
+//@ Calcula as rotas iniciais de todos os pacotes em lote (uma árvore por origem e peso)
+//@ Sem múltiplas rotas o peso é ignorado e, sem caminho, a rota vira o salto direto origem -> destino
+//@ Com uma tabela que cubra todos os pesos, os caminhos são lidos dela sem nenhuma busca
+void routeInitialPackages(ConfigDataExtended& config) {
+    int count = config.packageTable != nullptr ? config.packageTable->getSize() : 0;
+    if (count <= 0) {
+        return;
+    }
+
+    int* origins = new int[count];
+    int* destinations = new int[count];
+    int* weights = new int[count];
+    Route* routes = new Route[count];
+    for (int i = 0; i < count; ++i) {
+        PackageExtended pkg(*config.packageTable, i);
+        origins[i] = pkg.getInitialOrigin();
+        destinations[i] = pkg.getFinalDestination();
+        weights[i] = config.multipleRoutes ? pkg.getWeight() : 1;
+    }
+
+    bool fromTable = config.routeTable != nullptr && config.routeTable->getNumVertices() == config.numWarehouses;
+    for (int i = 0; i < count && fromTable; ++i) {
+        fromTable = config.routeTable->findLayer(weights[i]) != -1;
+    }
+
+    if (fromTable) {
+        int* path = new int[config.numWarehouses];
+        for (int i = 0; i < count; ++i) {
+            int length = config.routeTable->writePath(config.routeTable->findLayer(weights[i]), origins[i], destinations[i], path);
+            for (int k = 0; k < length; ++k) {
+                routes[i].path.addBack(path[k]);
+            }
+        }
+        delete[] path;
+    } else {
+        config.graph->findBestRoutes(origins, destinations, weights, count, routes, 0, *config.pool);
     }
 
+    for (int i = 0; i < count; ++i) {
+        RoutePath route = std::move(routes[i].path);
+        if (!config.multipleRoutes && route.isEmpty()) {
+            route.addBack(origins[i]);
+            if (origins[i] != destinations[i]) {
+                route.addBack(destinations[i]);
+            }
+        }
+        Package(*config.packageTable, i).setRoute(std::move(route));
+    }
+
+    delete[] origins;
+    delete[] destinations;
+    delete[] weights;
+    delete[] routes;
+}
+
+//@ Lê os parâmetros e a topologia (grafo, mudanças de aresta, motor de roteamento e hierarquia de contração)
+//@ O arquivo fica posicionado na linha do número de pacotes
+void readTopology(std::ifstream& file, const std::string& filename, ConfigDataExtended& config) {
     std::string line;
 
     // Lê parâmetros base
@@ -40,8 +99,27 @@ ConfigDataExtended loadInputExtended(const std::string& filename) {
         config.limitedStorageCapacity = (flags & 8) != 0;
         config.multipleRoutes = (flags & 16) != 0;
         config.dynamicRouting = (flags & 32) != 0;
+        config.contractionHierarchy = (flags & 64) != 0;
+        config.timeDependentRouting = (flags & 128) != 0;
+        config.lazyRouting = (flags & 256) != 0;
+        config.hugePages = (flags & 512) != 0;
+        config.adaptiveCapacity = (flags & 1024) != 0;
+
+        // Parâmetros opcionais no formato chave=valor após as flags
+        std::string token;
+        while (iss >> token) {
+            if (token.compare(0, 2, "k=") == 0) {
+                config.maxAlternativeRoutes = std::max(1, std::atoi(token.c_str() + 2));
+            } else if (token.compare(0, 14, "armazenamento=") == 0 && !parseStoragePolicy(token.substr(14), config.storagePolicy)) {
+                std::cerr << "Aviso: disciplina de armazenamento desconhecida em " << token << "; usando lifo" << std::endl;
+            }
+        }
     }
 
+    config.arena = new RegionArena(config.hugePages);
+    config.routes = config.arena->create<RouteArena>();
+    config.pool = config.arena->create<ThreadPool>();
+
     // Lê número de armazéns
     if (std::getline(file, line)) {
         std::istringstream iss(line);
@@ -53,7 +131,50 @@ ConfigDataExtended loadInputExtended(const std::string& filename) {
 
     // Lê arestas do grafo
     std::string graphLine;
+    std::vector<EdgeChange> edgeChanges;
     while (std::getline(file, graphLine) && !graphLine.empty()) {
+        // Mudança programada de uma aresta: "mudanca tempo origem destino fecha|abre|latencia"
+        if (graphLine.compare(0, 7, "mudanca") == 0) {
+            std::istringstream iss(graphLine.substr(7));
+            EdgeChange change = {};
+            std::string action;
+            iss >> change.time >> change.from >> change.to >> action;
+            if (action == "fecha") {
+                change.type = EDGE_DISABLE;
+            } else if (action == "abre") {
+                change.type = EDGE_ENABLE;
+            } else {
+                change.type = EDGE_LATENCY;
+                change.latency = std::atoi(action.c_str());
+            }
+
+            bool valid = !iss.fail() && change.time >= 0 && change.from >= 0 && change.from < config.numWarehouses && change.to >= 0 && change.to < config.numWarehouses &&
+                         (change.type != EDGE_LATENCY || change.latency > 0);
+            if (valid) {
+                edgeChanges.push_back(change);
+            } else {
+                std::cerr << "Mudança de aresta ignorada (tempo, armazém ou ação inválidos): " << graphLine << std::endl;
+            }
+            continue;
+        }
+
+        // Perfil de latência de uma aresta já lida: "perfil origem destino t1 l1 t2 l2 ..."
+        if (graphLine.compare(0, 6, "perfil") == 0) {
+            std::istringstream iss(graphLine.substr(6));
+            int from, to, time, latency;
+            std::vector<int> times;
+            std::vector<int> latencies;
+            iss >> from >> to;
+            while (iss >> time >> latency) {
+                times.push_back(time);
+                latencies.push_back(latency);
+            }
+            if (!config.graph->setLatencyProfile(from, to, times.data(), latencies.data(), static_cast<int>(times.size()))) {
+                std::cerr << "Perfil de latência ignorado (aresta inexistente, tempos fora de ordem ou violação FIFO): " << graphLine << std::endl;
+            }
+            continue;
+        }
+
         std::istringstream iss(graphLine);
         int from, to, capacity, latency;
         double timeMultiplier = 1.0;
@@ -68,13 +189,74 @@ ConfigDataExtended loadInputExtended(const std::string& filename) {
 
         config.graph->addEdge(from, to, capacity, latency, timeMultiplier);
     }
+    config.graph->compactEdges();
+
+    if (!edgeChanges.empty()) {
+        config.numEdgeChanges = static_cast<int>(edgeChanges.size());
+        config.edgeChanges = new EdgeChange[config.numEdgeChanges];
+        std::copy(edgeChanges.begin(), edgeChanges.end(), config.edgeChanges);
+    }
+
+    // Roteamento dependente do tempo dispensa a hierarquia, construída sobre latências estáticas
+    if (config.timeDependentRouting) {
+        config.graph->setRoutingEngine(TIME_DEPENDENT);
+        if (!config.graph->isFifo()) {
+            std::cerr << "Aviso: há arestas que violam FIFO; as rotas dependentes do tempo podem não ser ótimas" << std::endl;
+        }
+    }
+
+    // Hierarquia de contração: reaproveita o arquivo salvo quando a topologia confere
+    if (config.contractionHierarchy && !config.timeDependentRouting && config.numWarehouses > 0) {
+        std::string hierarchyFile = filename + ".ch";
+        ContractionHierarchy* hierarchy = ContractionHierarchy::loadFromFile(hierarchyFile, *config.graph);
+        if (hierarchy == nullptr) {
+            hierarchy = ContractionHierarchy::build(*config.graph, *config.pool);
+            if (!hierarchy->saveToFile(hierarchyFile)) {
+                std::cerr << "Aviso: não foi possível salvar a hierarquia de contração em " << hierarchyFile << std::endl;
+            }
+        }
+        config.graph->attachContractionHierarchy(hierarchy);
+    }
+}
+
+} // namespace
+
+ConfigDataExtended loadTopologyExtended(const std::string& filename) {
+    ConfigDataExtended config;
+    std::ifstream file(filename);
+
+    if (!file.is_open()) {
+        std::cerr << "Erro ao abrir arquivo: " << filename << std::endl;
+        return config;
+    }
+
+    readTopology(file, filename, config);
+    return config;
+}
+
+ConfigDataExtended loadInputExtended(const std::string& filename) {
+    ConfigDataExtended config;
+    std::ifstream file(filename);
+
+    if (!file.is_open()) {
+        std::cerr << "Erro ao abrir arquivo: " << filename << std::endl;
+        return config;
+    }
+
+    readTopology(file, filename, config);
+    std::string line;
+
+    // Tabela de rotas pré-calculada (route_table_builder); a hierarquia de contração pode desempatar diferente
+    if (!config.contractionHierarchy && config.numWarehouses > 0) {
+        config.routeTable = RouteTable::loadFromFile(filename + ".rt", RouteTable::computeTopologyHash(*config.graph));
+    }
 
     // Cria armazéns estendidos
-    config.warehouses = new WarehouseExtended*[config.numWarehouses];
+    config.warehouses = config.arena->allocateArray<WarehouseExtended*>(config.numWarehouses);
     for (int i = 0; i < config.numWarehouses; ++i) {
         int capacity = config.limitedStorageCapacity ? 1000 : 10000; // Capacidade padrão
         int weightCapacity = config.limitedStorageCapacity ? 5000 : 50000;
-        config.warehouses[i] = new WarehouseExtended(i, config.numWarehouses, capacity, weightCapacity);
+        config.warehouses[i] = config.arena->create<WarehouseExtended>(i, config.numWarehouses, config.graph->neighbors(i), capacity, weightCapacity, config.arena, config.storagePolicy);
     }
 
     // Lê número de pacotes
@@ -84,10 +266,12 @@ ConfigDataExtended loadInputExtended(const std::string& filename) {
     }
 
     // Cria pacotes estendidos
-    config.packages = new PackageExtended*[config.numPackages];
+    if (config.numPackages > 0) {
+        config.packageTable = config.arena->create<PackageTable>(config.numPackages, *config.routes, config.arena, true);
+    }
     std::random_device rd;
     std::mt19937 gen(rd());
-    std::uniform_int_distribution<> weightDist(1, 10);
+    std::uniform_int_distribution<> weightDist(1, MAX_PACKAGE_WEIGHT);
     std::uniform_real_distribution<> specialDist(0.0, 1.0);
 
     for (int i = 0; i < config.numPackages; ++i) {
@@ -99,40 +283,61 @@ ConfigDataExtended loadInputExtended(const std::string& filename) {
             int weight = config.variablePackageWeight ? weightDist(gen) : 1;
             bool specialHandling = specialDist(gen) < 0.1; // 10% dos pacotes precisam manuseio especial
 
-            config.packages[i] = new PackageExtended(id, origin, destination, postTime, weight, specialHandling);
-
-            // Calcula rota inicial
-            Route initialRoute = config.graph->findBestRoute(origin, destination, weight, 0);
-            if (initialRoute.path.getCurrentSize() > 0) {
-                config.packages[i]->setRoute(std::move(initialRoute.path));
-            }
+            config.packageTable->addExtended(id, origin, destination, postTime, weight, specialHandling);
         }
     }
 
+    // No modo sob demanda o escalonador calcula cada rota na postagem
+    if (!config.lazyRouting) {
+        routeInitialPackages(config);
+    }
+
     file.close();
     return config;
 }
 
 void cleanupExtended(ConfigDataExtended& data) {
-    // Limpa pacotes
-    if (data.packages) {
-        for (int i = 0; i < data.numPackages; ++i) {
-            delete data.packages[i];
-        }
-        delete[] data.packages;
-        data.packages = nullptr;
+    // Pacotes, armazéns, suas seções e a arena de rotas estão na região: uma única liberação
+    delete data.arena;
+    data.arena = nullptr;
+    data.packageTable = nullptr;
+    data.routes = nullptr;
+    data.pool = nullptr;
+    data.warehouses = nullptr;
+
+    // Limpa grafo e tabela de rotas
+    delete data.graph;
+    data.graph = nullptr;
+    delete data.routeTable;
+    data.routeTable = nullptr;
+    delete[] data.edgeChanges;
+    data.edgeChanges = nullptr;
+    data.numEdgeChanges = 0;
+}
+
+RouteTable* buildRouteTableExtended(const std::string& filename, int numThreads) {
+    ConfigDataExtended data = loadTopologyExtended(filename);
+    if (data.graph == nullptr || data.numWarehouses <= 0) {
+        cleanupExtended(data);
+        throw std::runtime_error("Nao foi possivel carregar a topologia de " + filename);
+    }
+    if (data.contractionHierarchy) {
+        std::cerr << "Aviso: com hierarquia de contração o carregador ignora a tabela de rotas" << std::endl;
     }
 
-    // Limpa armazéns
-    if (data.warehouses) {
-        for (int i = 0; i < data.numWarehouses; ++i) {
-            delete data.warehouses[i];
-        }
-        delete[] data.warehouses;
-        data.warehouses = nullptr;
+    int weights[MAX_PACKAGE_WEIGHT];
+    int numWeights = data.multipleRoutes && data.variablePackageWeight ? MAX_PACKAGE_WEIGHT : 1;
+    for (int k = 0; k < numWeights; ++k) {
+        weights[k] = k + 1;
     }
 
-    // Limpa grafo
-    delete data.graph;
-    data.graph = nullptr;
-}
\ No newline at end of file
+    RouteTable* table = nullptr;
+    try {
+        table = RouteTable::build(*data.graph, weights, numWeights, numThreads);
+    } catch (...) {
+        cleanupExtended(data);
+        throw;
+    }
+    cleanupExtended(data);
+    return table;
+}
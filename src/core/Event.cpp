@@ -1,9 +1,26 @@
 #include "../include/core/Event.h"
+#include "../include/utils/SlabAllocator.h"
 
-Event::Event(int time, Package* package) : type(EventType::PACKAGE_ARRIVAL), time(time), package(package), originWarehouseId(-1), destinationSectionId(-1) {}
+namespace {
 
-Event::Event(int time, int originWarehouseId, int destinationSectionId)
-    : type(EventType::LEAVE_TRANSPORT), time(time), package(nullptr), originWarehouseId(originWarehouseId), destinationSectionId(destinationSectionId) {}
+SlabPool& eventPool() {
+    static SlabPool pool("Event", sizeof(Event), alignof(Event));
+    return pool;
+}
+
+} // namespace
+
+Event::Event(int time, const Package& package)
+    : type(EventType::PACKAGE_ARRIVAL), time(time), packageIndex(package.getIndex()), originWarehouseId(-1), destinationSectionId(-1), edgeChange(EDGE_DISABLE), edgeLatency(0),
+      originOrderKey(package.getId()), sectionOrderKey(-1) {}
+
+Event::Event(int time, int originWarehouseId, int destinationSectionId, const int* externalIds)
+    : type(EventType::LEAVE_TRANSPORT), time(time), packageIndex(-1), originWarehouseId(originWarehouseId), destinationSectionId(destinationSectionId), edgeChange(EDGE_DISABLE), edgeLatency(0),
+      originOrderKey(externalIds ? externalIds[originWarehouseId] : originWarehouseId), sectionOrderKey(externalIds ? externalIds[destinationSectionId] : destinationSectionId) {}
+
+Event::Event(const EdgeChange& change)
+    : type(EventType::EDGE_CHANGE), time(change.time), packageIndex(-1), originWarehouseId(change.from), destinationSectionId(change.to), edgeChange(change.type), edgeLatency(change.latency),
+      originOrderKey(change.from), sectionOrderKey(change.to) {}
 
 bool Event::operator<(const Event& other) const noexcept {
     //* Compara os eventos com base no tempo, tipo e ID do pacote ou armazém
@@ -15,12 +32,29 @@ bool Event::operator<(const Event& other) const noexcept {
         return this->type < other.type;
     }
 
-    if (this->type == EventType::PACKAGE_ARRIVAL) {
-        return this->package->getId() < other.package->getId();
-    } else { 
-        if (this->originWarehouseId != other.originWarehouseId) {
-            return this->originWarehouseId < other.originWarehouseId;
-        }
-        return this->destinationSectionId < other.destinationSectionId;
+    //* Desempate pelo ID do pacote ou pelos IDs do arquivo de entrada, para que a reordenação dos armazéns não mude a saída
+    if (this->originOrderKey != other.originOrderKey) {
+        return this->originOrderKey < other.originOrderKey;
+    }
+    return this->sectionOrderKey < other.sectionOrderKey;
+}
+
+void* Event::operator new(std::size_t size) {
+    //* Classes derivadas maiores que Event não cabem nos objetos do pool
+    if (size != sizeof(Event)) {
+        return ::operator new(size);
+    }
+    return eventPool().allocate();
+}
+
+void Event::operator delete(void* event, std::size_t size) noexcept {
+    if (event == nullptr) {
+        return;
+    }
+    //* Mesmo critério do operator new: só objetos do tamanho de Event vieram do pool
+    if (size != sizeof(Event)) {
+        ::operator delete(event);
+        return;
     }
-}
\ No newline at end of file
+    eventPool().deallocate(event);
+}
@@ -0,0 +1,442 @@
+#include "../../include/core/RouteDaemon.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+//@ Instante atual em microssegundos (relógio monotônico)
+int64_t nowMicros() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//@ Acrescenta bytes ao final de um buffer
+void append(std::vector<char>& buffer, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+//@ Monta o endereço de um socket Unix, validando o tamanho do caminho
+sockaddr_un makeAddress(const std::string& socketPath) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Caminho do socket muito longo: " + socketPath);
+    }
+    std::strcpy(address.sun_path, socketPath.c_str());
+    return address;
+}
+
+//@ Envia todos os bytes (bloqueante)
+void writeFully(int fd, const void* data, size_t size) {
+    const char* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t sent = ::send(fd, bytes, size, MSG_NOSIGNAL);
+        if (sent < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("Erro ao enviar ao servidor de rotas: ") + std::strerror(errno));
+        }
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+}
+
+//@ Lê exatamente size bytes (bloqueante)
+void readFully(int fd, void* data, size_t size) {
+    char* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t received = ::recv(fd, bytes, size, 0);
+        if (received == 0) {
+            throw std::runtime_error("O servidor de rotas fechou a conexão.");
+        }
+        if (received < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("Erro ao receber do servidor de rotas: ") + std::strerror(errno));
+        }
+        bytes += received;
+        size -= static_cast<size_t>(received);
+    }
+}
+
+//@ Lê um cabeçalho e confere o número mágico e o tipo esperado
+RouteProtocol::FrameHeader readHeader(int fd, uint32_t expectedType) {
+    RouteProtocol::FrameHeader header;
+    readFully(fd, &header, sizeof(header));
+    if (header.magic != RouteProtocol::MAGIC || header.type != expectedType) {
+        throw std::runtime_error("Resposta inválida do servidor de rotas.");
+    }
+    return header;
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram() noexcept : buckets(), count(0), sum(0), maximum(0) {}
+
+int LatencyHistogram::bucketOf(int64_t value) noexcept {
+    uint64_t v = static_cast<uint64_t>(value);
+    if (v < static_cast<uint64_t>(SUB_BUCKETS)) {
+        return static_cast<int>(v);
+    }
+    //* Expoente e (v em [2^e, 2^(e+1))) escolhe a potência; os SUB_BITS bits seguintes escolhem a faixa dentro dela
+    int exponent = 63 - __builtin_clzll(v);
+    int shift = exponent - SUB_BITS;
+    return (shift + 1) * SUB_BUCKETS + static_cast<int>((v >> shift) & (SUB_BUCKETS - 1));
+}
+
+int64_t LatencyHistogram::upperBound(int bucket) noexcept {
+    if (bucket < SUB_BUCKETS) {
+        return bucket;
+    }
+    int shift = bucket / SUB_BUCKETS - 1;
+    uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+    return static_cast<int64_t>(lower + ((uint64_t(1) << shift) - 1));
+}
+
+void LatencyHistogram::record(int64_t value, int64_t times) noexcept {
+    if (times <= 0) {
+        return;
+    }
+    value = std::max<int64_t>(value, 0);
+    buckets[bucketOf(value)] += times;
+    count += times;
+    sum += value * times;
+    maximum = std::max(maximum, value);
+}
+
+int64_t LatencyHistogram::getCount() const noexcept {
+    return count;
+}
+
+void LatencyHistogram::getStats(int64_t stats[RouteProtocol::NUM_STATS]) const noexcept {
+    for (int k = 0; k < RouteProtocol::NUM_STATS; ++k) {
+        stats[k] = 0;
+    }
+    if (count == 0) {
+        return;
+    }
+
+    // Mesma posição que o vetor ordenado usaria; o percentil é o maior valor da faixa que contém essa posição
+    const double percentiles[3] = {0.50, 0.90, 0.99};
+    int bucket = 0;
+    int64_t seen = buckets[0];
+    for (int k = 0; k < 3; ++k) {
+        int64_t rank = static_cast<int64_t>(percentiles[k] * (count - 1) + 0.5);
+        while (seen <= rank) {
+            seen += buckets[++bucket];
+        }
+        stats[k] = std::min(upperBound(bucket), maximum);
+    }
+    stats[3] = maximum;
+    stats[4] = sum / count;
+}
+
+RouteDaemon::RouteDaemon(RouteService& service, const std::string& socketPath, int numThreads)
+    : service(service), pool(numThreads), socketPath(socketPath), listenFd(-1), stopping(0) {
+    if (pool.getNumThreads() > service.getNumWorkers()) {
+        throw std::invalid_argument("O serviço de rotas tem menos trabalhadores que as threads do servidor.");
+    }
+
+    sockaddr_un address = makeAddress(socketPath);
+    listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        throw std::runtime_error(std::string("Erro ao criar o socket: ") + std::strerror(errno));
+    }
+
+    //* Um socket antigo no mesmo caminho impediria o bind
+    ::unlink(socketPath.c_str());
+    if (::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || ::listen(listenFd, 16) < 0) {
+        int error = errno;
+        ::close(listenFd);
+        throw std::runtime_error("Erro ao escutar em " + socketPath + ": " + std::strerror(error));
+    }
+    ::fcntl(listenFd, F_SETFL, ::fcntl(listenFd, F_GETFL) | O_NONBLOCK);
+}
+
+RouteDaemon::~RouteDaemon() {
+    for (Connection& connection : connections) {
+        ::close(connection.fd);
+    }
+    if (listenFd >= 0) {
+        ::close(listenFd);
+        ::unlink(socketPath.c_str());
+    }
+}
+
+void RouteDaemon::requestStop() noexcept {
+    stopping = 1;
+}
+
+void RouteDaemon::run() {
+    std::vector<pollfd> descriptors;
+    char chunk[65536];
+
+    while (!stopping) {
+        descriptors.clear();
+        descriptors.push_back({listenFd, POLLIN, 0});
+        for (const Connection& connection : connections) {
+            short events = POLLIN;
+            if (connection.outputOffset < connection.output.size()) {
+                events |= POLLOUT;
+            }
+            descriptors.push_back({connection.fd, events, 0});
+        }
+
+        //* Timeout curto para perceber requestStop vindo de um sinal
+        int ready = ::poll(descriptors.data(), descriptors.size(), 200);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("Erro no poll: ") + std::strerror(errno));
+        }
+
+        if (descriptors[0].revents & POLLIN) {
+            int clientFd;
+            while ((clientFd = ::accept(listenFd, nullptr, nullptr)) >= 0) {
+                ::fcntl(clientFd, F_SETFL, ::fcntl(clientFd, F_GETFL) | O_NONBLOCK);
+                connections.push_back({clientFd, {}, {}, 0});
+            }
+        }
+
+        // As conexões aceitas nesta volta não têm entrada em descriptors
+        size_t polled = descriptors.size() - 1;
+        std::vector<bool> closed(connections.size(), false);
+        for (size_t c = 0; c < polled; ++c) {
+            Connection& connection = connections[c];
+            short revents = descriptors[c + 1].revents;
+
+            if (revents & (POLLIN | POLLHUP | POLLERR)) {
+                bool open = true;
+                while (open) {
+                    ssize_t received = ::recv(connection.fd, chunk, sizeof(chunk), 0);
+                    if (received > 0) {
+                        append(connection.input, chunk, static_cast<size_t>(received));
+                    } else if (received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                        open = false;
+                    } else {
+                        break;
+                    }
+                }
+
+                //* Todos os quadros completos desta leitura chegaram no mesmo instante
+                if (!processFrames(connection, nowMicros())) {
+                    open = false;
+                }
+                if (!open) {
+                    flush(connection); // Melhor esforço: o cliente pode ter fechado só o envio
+                    closed[c] = true;
+                    continue;
+                }
+            }
+
+            if (!flush(connection)) {
+                closed[c] = true;
+            }
+        }
+
+        for (size_t c = connections.size(); c-- > 0;) {
+            if (closed[c]) {
+                ::close(connections[c].fd);
+                connections.erase(connections.begin() + static_cast<long>(c));
+            }
+        }
+    }
+
+    // Entrega as respostas pendentes (como a confirmação de SHUTDOWN) antes de fechar
+    for (Connection& connection : connections) {
+        ::fcntl(connection.fd, F_SETFL, ::fcntl(connection.fd, F_GETFL) & ~O_NONBLOCK);
+        flush(connection);
+    }
+}
+
+bool RouteDaemon::processFrames(Connection& connection, int64_t arrivalMicros) {
+    using namespace RouteProtocol;
+
+    size_t offset = 0;
+    while (connection.input.size() - offset >= sizeof(FrameHeader)) {
+        FrameHeader header;
+        std::memcpy(&header, connection.input.data() + offset, sizeof(header));
+        if (header.magic != MAGIC) {
+            return false;
+        }
+
+        if (header.type == QUERY) {
+            if (header.count > MAX_QUERIES_PER_FRAME) {
+                return false;
+            }
+            size_t payload = header.count * sizeof(Query);
+            if (connection.input.size() - offset - sizeof(FrameHeader) < payload) {
+                break; // Quadro incompleto: espera mais bytes
+            }
+            std::vector<Query> queries(header.count);
+            if (payload > 0) {
+                std::memcpy(queries.data(), connection.input.data() + offset + sizeof(FrameHeader), payload);
+            }
+            for (const Query& query : queries) {
+                if (query.weight < 1) {
+                    return false;
+                }
+            }
+            answerQueries(connection, queries.data(), header.count, arrivalMicros);
+            offset += sizeof(FrameHeader) + payload;
+        } else if (header.type == STATS) {
+            answerStats(connection);
+            offset += sizeof(FrameHeader);
+        } else if (header.type == SHUTDOWN) {
+            FrameHeader reply = {MAGIC, SHUTDOWN, 0};
+            append(connection.output, &reply, sizeof(reply));
+            offset += sizeof(FrameHeader);
+            stopping = 1;
+        } else {
+            return false;
+        }
+    }
+
+    connection.input.erase(connection.input.begin(), connection.input.begin() + static_cast<long>(offset));
+    return true;
+}
+
+void RouteDaemon::answerQueries(Connection& connection, const RouteProtocol::Query* queries, uint32_t count, int64_t arrivalMicros) {
+    using namespace RouteProtocol;
+
+    int n = static_cast<int>(count);
+    routes.assign(n, Route());
+    if (n == 1) {
+        // Consulta isolada: passa pela fatia de cache do trabalhador 0
+        routes[0] = service.findBestRoute(queries[0].origin, queries[0].destination, queries[0].weight, queries[0].time, 0);
+    } else if (n > 1) {
+        // Lote: uma árvore por (origem, peso) em cada instante distinto do quadro
+        origins.resize(n);
+        destinations.resize(n);
+        weights.resize(n);
+        int first = 0;
+        while (first < n) {
+            int last = first;
+            while (last < n && queries[last].time == queries[first].time) {
+                origins[last] = queries[last].origin;
+                destinations[last] = queries[last].destination;
+                weights[last] = queries[last].weight;
+                last++;
+            }
+            service.findBestRoutes(origins.data() + first, destinations.data() + first, weights.data() + first, last - first, routes.data() + first, queries[first].time, pool);
+            first = last;
+        }
+    }
+
+    FrameHeader reply = {MAGIC, QUERY, count};
+    append(connection.output, &reply, sizeof(reply));
+    for (int i = 0; i < n; ++i) {
+        const RoutePath& path = routes[i].path;
+        int32_t length = path.getCurrentSize();
+        int32_t latency = length > 0 ? routes[i].totalLatency : -1;
+        append(connection.output, &latency, sizeof(latency));
+        append(connection.output, &length, sizeof(length));
+        for (int32_t node : path) {
+            append(connection.output, &node, sizeof(node));
+        }
+    }
+
+    latencies.record(nowMicros() - arrivalMicros, count);
+}
+
+void RouteDaemon::answerStats(Connection& connection) const {
+    using namespace RouteProtocol;
+
+    int64_t stats[NUM_STATS];
+    getLatencyStats(stats);
+    FrameHeader reply = {MAGIC, STATS, static_cast<uint32_t>(latencies.getCount())};
+    append(connection.output, &reply, sizeof(reply));
+    append(connection.output, stats, sizeof(stats));
+}
+
+bool RouteDaemon::flush(Connection& connection) {
+    while (connection.outputOffset < connection.output.size()) {
+        ssize_t sent = ::send(connection.fd, connection.output.data() + connection.outputOffset, connection.output.size() - connection.outputOffset, MSG_NOSIGNAL);
+        if (sent < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+        connection.outputOffset += static_cast<size_t>(sent);
+    }
+    connection.output.clear();
+    connection.outputOffset = 0;
+    return true;
+}
+
+void RouteDaemon::getLatencyStats(int64_t stats[RouteProtocol::NUM_STATS]) const {
+    latencies.getStats(stats);
+}
+
+int64_t RouteDaemon::getNumQueries() const noexcept {
+    return latencies.getCount();
+}
+
+RouteClient::RouteClient(const std::string& socketPath) : fd(-1) {
+    sockaddr_un address = makeAddress(socketPath);
+    fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        int error = errno;
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        throw std::runtime_error("Nao foi possivel conectar a " + socketPath + ": " + std::strerror(error));
+    }
+}
+
+RouteClient::~RouteClient() {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+void RouteClient::sendQueries(const RouteProtocol::Query* queries, uint32_t count) {
+    if (count > RouteProtocol::MAX_QUERIES_PER_FRAME) {
+        throw std::invalid_argument("Consultas demais em um único quadro.");
+    }
+    RouteProtocol::FrameHeader header = {RouteProtocol::MAGIC, RouteProtocol::QUERY, count};
+    writeFully(fd, &header, sizeof(header));
+    writeFully(fd, queries, count * sizeof(RouteProtocol::Query));
+}
+
+void RouteClient::receiveRoutes(std::vector<std::vector<int>>& routes) {
+    RouteProtocol::FrameHeader header = readHeader(fd, RouteProtocol::QUERY);
+    routes.assign(header.count, std::vector<int>());
+    for (uint32_t i = 0; i < header.count; ++i) {
+        int32_t fields[2];
+        readFully(fd, fields, sizeof(fields));
+        routes[i].resize(static_cast<size_t>(fields[1]) + 1);
+        routes[i][0] = fields[0];
+        if (fields[1] > 0) {
+            readFully(fd, routes[i].data() + 1, static_cast<size_t>(fields[1]) * sizeof(int32_t));
+        }
+    }
+}
+
+int64_t RouteClient::requestStats(int64_t stats[RouteProtocol::NUM_STATS]) {
+    RouteProtocol::FrameHeader header = {RouteProtocol::MAGIC, RouteProtocol::STATS, 0};
+    writeFully(fd, &header, sizeof(header));
+    RouteProtocol::FrameHeader reply = readHeader(fd, RouteProtocol::STATS);
+    readFully(fd, stats, RouteProtocol::NUM_STATS * sizeof(int64_t));
+    return reply.count;
+}
+
+void RouteClient::requestShutdown() {
+    RouteProtocol::FrameHeader header = {RouteProtocol::MAGIC, RouteProtocol::SHUTDOWN, 0};
+    writeFully(fd, &header, sizeof(header));
+    readHeader(fd, RouteProtocol::SHUTDOWN);
+}
+
+void RouteClient::abort() noexcept {
+    ::shutdown(fd, SHUT_RDWR);
+}
@@ -1,13 +1,14 @@
 #include "../../include/core/Scheduler.h"
 #include "../../include/core/ConfigData.h"
+#include "../../include/domains/Package.h"
 #include "../../include/domains/Warehouse.h"
 #include "../../include/utils/Logger.h"
 #include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
-Scheduler::Scheduler(const ConfigData& configData, int maxEvents) : eventsHeap(maxEvents), timer() {
-    if (configData.packages == nullptr || configData.warehouses == nullptr || configData.graph == nullptr) {
+Scheduler::Scheduler(const ConfigData& configData, int maxEvents) : eventsHeap(maxEvents), timer(), externalIds(configData.externalIds), router(nullptr), packages(configData.packageTable), departureBuffer(nullptr), departureBufferCapacity(0) {
+    if (configData.packageTable == nullptr || configData.warehouses == nullptr || configData.graph == nullptr) {
         throw std::invalid_argument("Dados de configuração inválidos foram passados para o Scheduler.");
     }
     //* Inicializa os atributos do Scheduler com os dados de configuração
@@ -17,13 +18,17 @@ Scheduler::Scheduler(const ConfigData& configData, int maxEvents) : eventsHeap(m
     this->removalCost = configData.removalCost;
 
     this->activePackages = configData.numPackages;
+    this->storagePolicy = configData.storagePolicy;
+
+    //* No modo sob demanda cada rota só é calculada quando o pacote é postado
+    if (configData.lazyRouting) {
+        this->router = new Routing::OnDemandRouter(*configData.graph, *configData.routes, configData.routeTable);
+    }
 
     //* Insere os eventos de chegada de pacotes no heap de eventos
-    for (int i = 0; i < configData.numPackages; ++i) {
-        Package* package = configData.packages[i];
-        if (package != nullptr) {
-            this->eventsHeap.insert(new Event(package->getPostTime(), package));
-        }
+    for (int i = 0; i < this->packages->getSize(); ++i) {
+        Package package(*this->packages, i);
+        this->eventsHeap.insert(new Event(package.getPostTime(), package));
     }
 }
 
@@ -33,6 +38,8 @@ Scheduler::~Scheduler() {
         Event* event = this->eventsHeap.extractMin();
         delete event;
     }
+    delete this->router;
+    delete[] this->departureBuffer;
 }
 
 void Scheduler::runSimulation(Warehouse** warehouses, Graph* graph, int numWarehouses) {
@@ -72,6 +79,10 @@ void Scheduler::runSimulation(Warehouse** warehouses, Graph* graph, int numWareh
     }
 }
 
+int Scheduler::externalId(int internalId) const noexcept {
+    return externalIds ? externalIds[internalId] : internalId;
+}
+
 void Scheduler::initializeTransportEvents(Graph* graph, int numWarehouses) {
     if (this->eventsHeap.isEmpty())
         return;
@@ -83,36 +94,39 @@ void Scheduler::initializeTransportEvents(Graph* graph, int numWarehouses) {
 
     //* Insere eventos de transporte para cada par de armazéns conectados no grafo
     for (int i = 0; i < numWarehouses; ++i) {
-        for (int j = 0; j < numWarehouses; ++j) {
-            if (graph->hasEdge(i, j)) {
-                this->eventsHeap.insert(new Event(initialTransportTime, i, j));
-            }
+        for (int j : graph->neighbors(i)) {
+            this->eventsHeap.insert(new Event(initialTransportTime, i, j, externalIds));
         }
     }
 }
 
 void Scheduler::handlePackageArrival(Event* event, Warehouse** warehouses) {
     //* Verifica se o evento é válido e se o pacote está presente
-    Package* package = event->package;
-    if (!package)
+    if (event->packageIndex == -1)
         return;
-    int currentWarehouseId = package->getRoute().peekFront();
+    Package package(*this->packages, event->packageIndex);
+
+    //* Primeira chegada (postagem) no modo sob demanda: a rota ainda não existe
+    if (this->router != nullptr && package.getState() == PackageState::NOT_POSTED) {
+        package.setRoute(this->router->route(package.getInitialOrigin(), package.getFinalDestination()));
+    }
+    int currentWarehouseId = package.peekRoute();
 
     //* Se a rota do pacote so tem um armazém, significa que o pacote chegou ao destino final
-    if (package->getRoute().getCurrentSize() == 1) {
+    if (package.getRemainingRouteSize() == 1) {
         //* Se o pacote chegou ao destino final, atualiza o estado para DELIVERED
-        package->setState(PackageState::DELIVERED);
-        logPackageDelivered(timer.getTime(), package->getId(), currentWarehouseId);
+        package.setState(PackageState::DELIVERED);
+        logPackageDelivered(timer.getTime(), package.getId(), externalId(currentWarehouseId));
         this->activePackages--;
     } else {
         //* Se o pacote ainda tem armazéns na rota, remove o armazém atual da rota
         //* e armazena o pacote no próximo armazém da rota
-        package->getRoute().removeFront();
-        int nextWarehouseId = package->getRoute().peekFront();
+        package.advanceRoute();
+        int nextWarehouseId = package.peekRoute();
         warehouses[currentWarehouseId]->storePackage(package, nextWarehouseId);
-        package->setCurrentLocation(currentWarehouseId);
-        package->setState(PackageState::STORED);
-        logPackageStored(timer.getTime(), package->getId(), currentWarehouseId, nextWarehouseId);
+        package.setCurrentLocation(currentWarehouseId);
+        package.setState(PackageState::STORED);
+        logPackageStored(timer.getTime(), package.getId(), externalId(currentWarehouseId), externalId(nextWarehouseId));
     }
 }
 
@@ -125,7 +139,7 @@ void Scheduler::handleTransportDeparture(Event* event, Warehouse** warehouses) {
     //* Se ainda houver pacotes ativos, insere um novo evento de transporte no heap
     if (this->activePackages > 0) {
         int nextTransportTime = event->time + this->transportInterval;
-        this->eventsHeap.insert(new Event(nextTransportTime, originId, sectionId));
+        this->eventsHeap.insert(new Event(nextTransportTime, originId, sectionId, externalIds));
     }
 
     //* Se a seção do armazém de origem estiver vazia, não há pacotes para transportar
@@ -133,20 +147,29 @@ void Scheduler::handleTransportDeparture(Event* event, Warehouse** warehouses) {
         return;
     }
 
+    //* Nas seções acessadas pela frente só os pacotes transportados são removidos
+    if (this->storagePolicy != LIFO_STORAGE) {
+        departFromFront(originWarehouse, originId, sectionId, event->time);
+        return;
+    }
+
     //* Recupera os pacotes da seção do armazém de origem usando uma pilha LIFO
     //* Isso garante que os pacotes sejam removidos na ordem inversa em que foram armazenados
     int numPackagesInSection = originWarehouse->getSectionSize(sectionId);
-    Package** lifoBuffer = new Package*[numPackagesInSection];
-    for (int i = 0; i < numPackagesInSection; ++i) {
-        lifoBuffer[i] = originWarehouse->retrievePackage(sectionId);
+    if (numPackagesInSection > this->departureBufferCapacity) {
+        delete[] this->departureBuffer;
+        this->departureBufferCapacity = std::max(numPackagesInSection, 2 * this->departureBufferCapacity);
+        this->departureBuffer = new Package[this->departureBufferCapacity];
     }
+    Package* lifoBuffer = this->departureBuffer;
+    originWarehouse->retrievePackages(sectionId, numPackagesInSection, lifoBuffer);
 
     //* Registra o tempo de remoção dos pacotes
     double lastRemovalTime = event->time;
     //* Registra a remoção de cada pacote da seção do armazém de origem
     for (int i = 0; i < numPackagesInSection; i++) {
         lastRemovalTime += this->removalCost;
-        logPackageRemoved(lastRemovalTime, lifoBuffer[i]->getId(), originId, sectionId);
+        logPackageRemoved(lastRemovalTime, lifoBuffer[i].getId(), externalId(originId), externalId(sectionId));
     }
 
     //* Calcula quantos pacotes serão transportados e quantos serão restaurados
@@ -155,23 +178,51 @@ void Scheduler::handleTransportDeparture(Event* event, Warehouse** warehouses) {
 
     //* Registra os pacotes que estão sendo transportados e restaura os pacotes restantes
     for (int i = numPackagesInSection - 1; i >= numToRestore; --i) {
-        Package* package = lifoBuffer[i];
-        logPackageInTransit(lastRemovalTime, package->getId(), originId, sectionId);
+        const Package& package = lifoBuffer[i];
+        logPackageInTransit(lastRemovalTime, package.getId(), externalId(originId), externalId(sectionId));
 
         int arrivalTime = lastRemovalTime + this->transportLatency;
         this->eventsHeap.insert(new Event(arrivalTime, package));
     }
 
-    //* Restaura os pacotes restantes na seção do armazém de origem
+    //* Restaura os pacotes restantes na seção do armazém de origem, na mesma ordem de antes
     //* Isso garante que os pacotes que não foram transportados ainda estejam disponíveis
+    originWarehouse->restorePackages(sectionId, lifoBuffer, numToRestore);
     for (int i = numToRestore - 1; i >= 0; --i) {
-        Package* package = lifoBuffer[i];
-        originWarehouse->storePackage(package, sectionId);
-        logPackageRestored(lastRemovalTime, package->getId(), originId, sectionId);
+        logPackageRestored(lastRemovalTime, lifoBuffer[i].getId(), externalId(originId), externalId(sectionId));
     }
+}
+
+void Scheduler::departFromFront(Warehouse* originWarehouse, int originId, int sectionId, int time) {
+    //* A seção já está na ordem de saída: os transportados são os da frente, e nenhum outro é manuseado
+    int numToTransport = std::min(originWarehouse->getSectionSize(sectionId), this->transportCapacity);
+    if (numToTransport > this->departureBufferCapacity) {
+        delete[] this->departureBuffer;
+        this->departureBufferCapacity = std::max(numToTransport, 2 * this->departureBufferCapacity);
+        this->departureBuffer = new Package[this->departureBufferCapacity];
+    }
+    Package* frontBuffer = this->departureBuffer;
+    originWarehouse->retrievePackages(sectionId, numToTransport, frontBuffer);
+
+    //* Os pacotes deslocados pelas inserções ordenadas voltam ao lugar antes da retirada
+    double lastRemovalTime = time;
+    int moves = originWarehouse->takePendingMoves(sectionId);
+    if (moves > 0) {
+        lastRemovalTime += moves * this->removalCost;
+        logSectionReshelved(lastRemovalTime, externalId(originId), externalId(sectionId), moves);
+    }
+    for (int i = 0; i < numToTransport; i++) {
+        lastRemovalTime += this->removalCost;
+        logPackageRemoved(lastRemovalTime, frontBuffer[i].getId(), externalId(originId), externalId(sectionId));
+    }
+
+    for (int i = 0; i < numToTransport; i++) {
+        const Package& package = frontBuffer[i];
+        logPackageInTransit(lastRemovalTime, package.getId(), externalId(originId), externalId(sectionId));
 
-    //* Libera a memória alocada para o buffer LIFO
-    delete[] lifoBuffer;
+        int arrivalTime = lastRemovalTime + this->transportLatency;
+        this->eventsHeap.insert(new Event(arrivalTime, package));
+    }
 }
 
 Event* Scheduler::getNextEvent() {
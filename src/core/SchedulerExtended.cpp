@@ -1,13 +1,21 @@
 #include "../../include/core/SchedulerExtended.h"
+#include "../../include/dataStructures/KShortestPaths.h"
 #include "../../include/utils/Logger.h"
+#include "../../include/utils/ThreadPool.h"
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 SchedulerExtended::SchedulerExtended(const ConfigDataExtended& configData, int maxEvents)
-    : eventsHeap(maxEvents), timer(), routeRecalculations(0), capacityOverflows(0), weightOverflows(0), alternativeRoutesUsed(0) {
+    : eventsHeap(maxEvents), timer(), edgeChanges(configData.edgeChanges), numEdgeChanges(configData.numEdgeChanges), pendingReopenings(0), departureBuffer(nullptr), departureBufferCapacity(0), routeRecalculations(0), capacityOverflows(0), weightOverflows(0),
+      alternativeRoutesUsed(0), undeliverablePackages(0) {
 
-    if (configData.packages == nullptr || configData.warehouses == nullptr || configData.graph == nullptr) {
+    // Cenários sem pacotes ou sem armazéns não têm tabela ou vetor (a região não aloca blocos vazios)
+    bool missingPackages = configData.packageTable == nullptr && configData.numPackages > 0;
+    bool missingWarehouses = configData.warehouses == nullptr && configData.numWarehouses > 0;
+    if (missingPackages || missingWarehouses || configData.graph == nullptr || configData.pool == nullptr) {
         throw std::invalid_argument("Dados de configuração inválidos foram passados para o SchedulerExtended.");
     }
 
@@ -25,13 +33,22 @@ SchedulerExtended::SchedulerExtended(const ConfigDataExtended& configData, int m
     this->limitedStorageCapacity = configData.limitedStorageCapacity;
     this->multipleRoutes = configData.multipleRoutes;
     this->dynamicRouting = configData.dynamicRouting;
+    this->lazyRouting = configData.lazyRouting;
+    this->adaptiveCapacity = configData.adaptiveCapacity;
+    this->maxAlternativeRoutes = configData.maxAlternativeRoutes;
+    this->storagePolicy = configData.storagePolicy;
+    this->routes = configData.routes;
+    this->packages = configData.packageTable;
+    this->pool = configData.pool;
+
+    for (int i = 0; i < numEdgeChanges; ++i) {
+        pendingReopenings += edgeChanges[i].type == EDGE_ENABLE;
+    }
 
     // Insere eventos de chegada de pacotes
-    for (int i = 0; i < configData.numPackages; ++i) {
-        PackageExtended* package = configData.packages[i];
-        if (package != nullptr) {
-            this->eventsHeap.insert(new Event(package->getPostTime(), package));
-        }
+    for (int i = 0; packages != nullptr && i < packages->getSize(); ++i) {
+        PackageExtended package(*packages, i);
+        this->eventsHeap.insert(new Event(package.getPostTime(), package));
     }
 }
 
@@ -41,6 +58,7 @@ SchedulerExtended::~SchedulerExtended() {
         Event* event = eventsHeap.extractMin();
         delete event;
     }
+    delete[] departureBuffer;
 }
 
 void SchedulerExtended::runSimulation(WarehouseExtended** warehouses, GraphExtended* graph, int numWarehouses) {
@@ -48,6 +66,11 @@ void SchedulerExtended::runSimulation(WarehouseExtended** warehouses, GraphExten
         initializeTransportEvents(graph, numWarehouses);
     }
 
+    // Mudanças de aresta entram depois, para não alterar o instante do primeiro transporte
+    for (int i = 0; i < numEdgeChanges; ++i) {
+        this->eventsHeap.insert(new Event(edgeChanges[i]));
+    }
+
     while (!this->eventsHeap.isEmpty()) {
         Event* event = removeNextEvent();
         if (event == nullptr)
@@ -70,6 +93,9 @@ void SchedulerExtended::runSimulation(WarehouseExtended** warehouses, GraphExten
         case EventType::LEAVE_TRANSPORT:
             handleTransportDeparture(event, warehouses, graph);
             break;
+        case EventType::EDGE_CHANGE:
+            handleEdgeChange(event, warehouses, graph);
+            break;
         default:
             break;
         }
@@ -86,43 +112,68 @@ void SchedulerExtended::initializeTransportEvents(GraphExtended* graph, int numW
     double initialTransportTime = firstPackageTime + this->transportInterval;
 
     for (int i = 0; i < numWarehouses; ++i) {
-        for (int j = 0; j < numWarehouses; ++j) {
-            if (graph->hasEdge(i, j)) {
-                this->eventsHeap.insert(new Event(initialTransportTime, i, j));
-            }
+        for (int j : graph->neighbors(i)) {
+            this->eventsHeap.insert(new Event(initialTransportTime, i, j));
         }
     }
 }
 
 void SchedulerExtended::handlePackageArrival(Event* event, WarehouseExtended** warehouses, GraphExtended* graph) {
-    PackageExtended* package = static_cast<PackageExtended*>(event->package);
-    if (!package)
+    if (event->packageIndex == -1)
         return;
+    PackageExtended package(*packages, event->packageIndex);
 
-    int currentWarehouseId = package->getRoute().peekFront();
+    // Primeira chegada (postagem) no modo sob demanda: a rota ainda não existe
+    if (lazyRouting && package.getState() == PackageState::NOT_POSTED) {
+        routeOnPosting(package, graph, timer.getTime());
+    }
+
+    int currentWarehouseId = package.peekRoute();
 
-    if (package->getRoute().getCurrentSize() == 1) {
+    // Pacote em trânsito durante o fechamento de uma aresta da sua rota: recalcula a partir daqui
+    if (graph->getNumClosedEdges() > 0 && remainingRouteUsesClosedEdge(package, graph)) {
+        int weight = multipleRoutes ? package.getWeight() : 1;
+        Route detour = graph->findBestRoute(currentWarehouseId, package.getFinalDestination(), weight, timer.getTime());
+        if (detour.path.getCurrentSize() >= 2) {
+            package.saveRouteAsPrevious();
+            package.setRoute(detour.path);
+            package.updateLastRouteCalculation(timer.getTime());
+            routeRecalculations++;
+        } else if (pendingReopenings == 0) {
+            dropUndeliverable(package, currentWarehouseId);
+            return;
+        }
+    }
+
+    if (package.getRemainingRouteSize() == 1) {
         // Pacote chegou ao destino final
-        package->setState(PackageState::DELIVERED);
-        logPackageDelivered(timer.getTime(), package->getId(), currentWarehouseId);
+        package.setState(PackageState::DELIVERED);
+        logPackageDelivered(timer.getTime(), package.getId(), currentWarehouseId);
         this->activePackages--;
     } else {
         // Roteamento dinâmico
         if (dynamicRouting && shouldRecalculateRoute(package, graph, timer.getTime())) {
-            calculateDynamicRoute(package, graph, timer.getTime());
+            calculateDynamicRoute(package, warehouses, graph, timer.getTime());
             routeRecalculations++;
         }
 
-        package->getRoute().removeFront();
-        int nextWarehouseId = package->getRoute().peekFront();
+        package.advanceRoute();
+        int nextWarehouseId = package.peekRoute();
 
         // Tenta armazenar considerando capacidade limitada
         bool stored = false;
         if (limitedStorageCapacity) {
-            stored = warehouses[currentWarehouseId]->storePackage(package, nextWarehouseId);
+            // Seção cheia: o pacote vai para a fila de espera, o que conta como overflow (de espaço ou, se couber, de peso)
+            WarehouseExtended* warehouse = warehouses[currentWarehouseId];
+            if (package.getStorageSpaceRequired() > warehouse->getSectionAvailableCapacity(nextWarehouseId)) {
+                capacityOverflows++;
+            } else if (package.getWeight() > warehouse->getSectionAvailableWeight(nextWarehouseId)) {
+                weightOverflows++;
+            }
+
+            stored = warehouse->storePackage(package, nextWarehouseId);
             if (!stored) {
                 handleCapacityOverflow(package, warehouses, graph->getNumWarehouses());
-                capacityOverflows++;
             }
         } else {
             // Armazenamento ilimitado (versão original)
@@ -130,11 +181,26 @@ void SchedulerExtended::handlePackageArrival(Event* event, WarehouseExtended** w
         }
 
         if (stored) {
-            package->setCurrentLocation(currentWarehouseId);
-            package->setState(PackageState::STORED);
-            logPackageStored(timer.getTime(), package->getId(), currentWarehouseId, nextWarehouseId);
+            package.setCurrentLocation(currentWarehouseId);
+            package.setState(PackageState::STORED);
+            logPackageStored(timer.getTime(), package.getId(), currentWarehouseId, nextWarehouseId);
+        }
+    }
+}
+
+void SchedulerExtended::routeOnPosting(PackageExtended& package, GraphExtended* graph, int currentTime) {
+    int origin = package.getInitialOrigin();
+    int destination = package.getFinalDestination();
+    int weight = multipleRoutes ? package.getWeight() : 1;
+
+    Route best = graph->findBestRoute(origin, destination, weight, currentTime);
+    if (!multipleRoutes && best.path.isEmpty()) {
+        best.path.addBack(origin);
+        if (origin != destination) {
+            best.path.addBack(destination);
         }
     }
+    package.setRoute(best.path);
 }
 
 void SchedulerExtended::handleTransportDeparture(Event* event, WarehouseExtended** warehouses, GraphExtended* graph) {
@@ -148,7 +214,13 @@ void SchedulerExtended::handleTransportDeparture(Event* event, WarehouseExtended
         this->eventsHeap.insert(new Event(nextTransportTime, originId, sectionId));
     }
 
-    if (originWarehouse->isSectionEmpty(sectionId)) {
+    // As partidas de um armazém coincidem a cada intervalo: a primeira delas rebalanceia as seções
+    if (adaptiveCapacity) {
+        originWarehouse->optimizeCapacity(event->time);
+    }
+
+    // Seção vazia ou aresta fechada: nada parte (os pacotes esperam a reabertura ou um desvio)
+    if (originWarehouse->isSectionEmpty(sectionId) || graph->getEdgeInfo(originId, sectionId).isClosed) {
         return;
     }
 
@@ -158,25 +230,38 @@ void SchedulerExtended::handleTransportDeparture(Event* event, WarehouseExtended
         dynamicCapacity = calculateDynamicTransportCapacity(originId, sectionId, graph);
     }
 
-    // Remove pacotes da seção
+    // Remove pacotes da seção: na pilha LIFO todos saem e os que não couberem voltam;
+    // nas demais disciplinas a seção já está na ordem de saída e só os transportados são removidos
+    bool wholeSection = storagePolicy == LIFO_STORAGE;
     int numPackagesInSection = originWarehouse->getSectionSize(sectionId);
-    PackageExtended** lifoBuffer = new PackageExtended*[numPackagesInSection];
-
-    for (int i = 0; i < numPackagesInSection; ++i) {
-        lifoBuffer[i] = originWarehouse->retrievePackage(sectionId);
+    if (!wholeSection) {
+        numPackagesInSection = std::min(numPackagesInSection, dynamicCapacity);
+    }
+    if (numPackagesInSection > departureBufferCapacity) {
+        delete[] departureBuffer;
+        departureBufferCapacity = std::max(numPackagesInSection, 2 * departureBufferCapacity);
+        departureBuffer = new PackageExtended[departureBufferCapacity];
     }
+    PackageExtended* lifoBuffer = departureBuffer;
+    originWarehouse->retrievePackages(sectionId, numPackagesInSection, lifoBuffer);
 
-    // Calcula tempo de remoção considerando peso dos pacotes
+    // Calcula tempo de remoção considerando peso dos pacotes; antes, os pacotes deslocados pelas
+    // inserções ordenadas voltam ao lugar (um removalCost cada)
     double lastRemovalTime = event->time;
+    int moves = originWarehouse->takePendingMoves(sectionId);
+    if (moves > 0) {
+        lastRemovalTime += moves * removalCost;
+        logSectionReshelved(lastRemovalTime, originId, sectionId, moves);
+    }
     for (int i = 0; i < numPackagesInSection; i++) {
         int removalCostAdjusted = removalCost;
         if (variablePackageWeight && lifoBuffer[i]) {
             // Tempo de remoção aumenta com o peso
-            removalCostAdjusted = static_cast<int>(removalCost * lifoBuffer[i]->getWeightImpactFactor());
+            removalCostAdjusted = static_cast<int>(removalCost * lifoBuffer[i].getWeightImpactFactor());
         }
         lastRemovalTime += removalCostAdjusted;
         if (lifoBuffer[i]) {
-            logPackageRemoved(lastRemovalTime, lifoBuffer[i]->getId(), originId, sectionId);
+            logPackageRemoved(lastRemovalTime, lifoBuffer[i].getId(), originId, sectionId);
         }
     }
 
@@ -184,11 +269,11 @@ void SchedulerExtended::handleTransportDeparture(Event* event, WarehouseExtended
     int numToTransport = std::min(numPackagesInSection, dynamicCapacity);
     int numToRestore = numPackagesInSection - numToTransport;
 
-    // Transporta pacotes
-    for (int i = numPackagesInSection - 1; i >= numToRestore; --i) {
-        PackageExtended* package = lifoBuffer[i];
+    // Transporta pacotes, do primeiro a sair da seção (a base da pilha LIFO, a frente nas demais) ao último
+    for (int t = 0; t < numToTransport; ++t) {
+        const PackageExtended& package = wholeSection ? lifoBuffer[numPackagesInSection - 1 - t] : lifoBuffer[t];
         if (package) {
-            logPackageInTransit(lastRemovalTime, package->getId(), originId, sectionId);
+            logPackageInTransit(lastRemovalTime, package.getId(), originId, sectionId);
 
             // Calcula latência dinâmica baseada no peso e tempo
             int latency = transportLatency;
@@ -196,7 +281,7 @@ void SchedulerExtended::handleTransportDeparture(Event* event, WarehouseExtended
                 latency = graph->getDynamicLatency(originId, sectionId);
             }
             if (variablePackageWeight) {
-                latency = static_cast<int>(latency * package->getWeightImpactFactor());
+                latency = static_cast<int>(latency * package.getWeightImpactFactor());
             }
 
             int arrivalTime = lastRemovalTime + latency;
@@ -206,43 +291,244 @@ void SchedulerExtended::handleTransportDeparture(Event* event, WarehouseExtended
 
     // Restaura pacotes não transportados
     for (int i = numToRestore - 1; i >= 0; --i) {
-        PackageExtended* package = lifoBuffer[i];
+        const PackageExtended& package = lifoBuffer[i];
         if (package) {
-            originWarehouse->storePackage(package, sectionId);
-            logPackageRestored(lastRemovalTime, package->getId(), originId, sectionId);
+            originWarehouse->storePackage(package, sectionId, false);
+            logPackageRestored(lastRemovalTime, package.getId(), originId, sectionId);
+        }
+    }
+}
+
+void SchedulerExtended::handleEdgeChange(Event* event, WarehouseExtended** warehouses, GraphExtended* graph) {
+    int from = event->originWarehouseId;
+    int to = event->destinationSectionId;
+    int now = timer.getTime();
+
+    // Só uma aresta fechada ou mais cara pode tornar inválida ou pior uma rota que passa por ela
+    bool worsened = false;
+    switch (event->edgeChange) {
+    case EDGE_DISABLE:
+        if (!graph->setEdgeActive(from, to, false)) {
+            return;
+        }
+        logEdgeClosed(now, from, to);
+        worsened = true;
+        break;
+    case EDGE_ENABLE: {
+        pendingReopenings--;
+        bool reopened = graph->setEdgeActive(from, to, true);
+        if (reopened) {
+            logEdgeReopened(now, from, to);
+        }
+
+        // Pacotes parados diante de arestas ainda fechadas podem ganhar um desvio pela aresta reaberta;
+        // depois da última reabertura, os que continuam sem caminho são descartados
+        if (graph->getNumClosedEdges() > 0 && (reopened || pendingReopenings == 0)) {
+            rerouteStoredPackages(-1, -1, warehouses, graph);
+        }
+        break;
+    }
+    case EDGE_LATENCY: {
+        EdgeInfo edge = graph->getEdgeInfo(from, to);
+        if (!graph->setEdgeLatency(from, to, event->edgeLatency)) {
+            return;
+        }
+        logEdgeLatencyChanged(now, from, to, event->edgeLatency);
+        worsened = edge.isActive && event->edgeLatency > edge.baseLatency;
+        break;
+    }
+    }
+
+    if (worsened) {
+        rerouteStoredPackages(from, to, warehouses, graph);
+    }
+}
+
+void SchedulerExtended::rerouteStoredPackages(int from, int to, WarehouseExtended** warehouses, GraphExtended* graph) {
+    RouteArena& arena = *routes;
+    int numWarehouses = graph->getNumWarehouses();
+    int now = timer.getTime();
+
+    // Arestas fechadas ordenadas por chave (menor * numWarehouses + maior), consultadas por busca binária
+    int numClosed = from == -1 ? graph->getNumClosedEdges() : 0;
+    const int* closed = graph->getClosedEdges();
+    std::vector<long long> closedKeys(numClosed);
+    for (int k = 0; k < numClosed; ++k) {
+        closedKeys[k] = static_cast<long long>(closed[2 * k]) * numWarehouses + closed[2 * k + 1];
+    }
+    std::sort(closedKeys.begin(), closedKeys.end());
+    auto isClosed = [&](int i, int j) {
+        long long key = static_cast<long long>(std::min(i, j)) * numWarehouses + std::max(i, j);
+        return std::binary_search(closedKeys.begin(), closedKeys.end(), key);
+    };
+
+    // Última posição k do caminho em que (k, k + 1) é a aresta (ou uma aresta fechada),
+    // memorizada por caminho internado (-2 ainda não calculada)
+    std::vector<int> lastUse(arena.getNumPaths(), -2);
+    auto usesEdge = [&](const PackageExtended& pkg) {
+        int pathId = pkg.getRouteId();
+        if (lastUse[pathId] == -2) {
+            const int* nodes = arena.getNodes(pathId);
+            int length = arena.getLength(pathId);
+            lastUse[pathId] = -1;
+            for (int k = length - 2; k >= 0; --k) {
+                bool matches = from == -1 ? isClosed(nodes[k], nodes[k + 1])
+                                          : (nodes[k] == from && nodes[k + 1] == to) || (nodes[k] == to && nodes[k + 1] == from);
+                if (matches) {
+                    lastUse[pathId] = k;
+                    break;
+                }
+            }
+        }
+        //* A rota restante começa no armazém atual, uma posição antes do próximo salto
+        return lastUse[pathId] >= pkg.getRouteHop() - 1;
+    };
+
+    // Retira os pacotes afetados das seções; só as seções de arestas existentes podem ter pacotes
+    std::vector<PackageExtended> affected;
+    std::vector<int> locations;
+    std::vector<PackageExtended> removed;
+    auto collect = [&](int warehouse, int section) {
+        int size = warehouses[warehouse]->getSectionSize(section) + warehouses[warehouse]->getWaitingQueueSize(section);
+        if (size == 0) {
+            return;
+        }
+        removed.resize(size);
+        int count = warehouses[warehouse]->removePackagesIf(section, usesEdge, removed.data());
+        for (int k = 0; k < count; ++k) {
+            affected.push_back(removed[k]);
+            locations.push_back(warehouse);
+        }
+    };
+    for (int w = 0; w < numWarehouses; ++w) {
+        for (int section : graph->neighbors(w)) {
+            collect(w, section);
+        }
+    }
+    // Seções de arestas fechadas não aparecem nos vizinhos
+    if (from != -1 && !graph->hasEdge(from, to)) {
+        collect(from, to);
+        collect(to, from);
+    }
+    for (int k = 0; k < numClosed; ++k) {
+        collect(closed[2 * k], closed[2 * k + 1]);
+        collect(closed[2 * k + 1], closed[2 * k]);
+    }
+    if (affected.empty()) {
+        return;
+    }
+
+    int count = static_cast<int>(affected.size());
+    std::vector<int> destinations(count);
+    std::vector<int> weights(count);
+    for (int k = 0; k < count; ++k) {
+        destinations[k] = affected[k].getFinalDestination();
+        weights[k] = multipleRoutes ? affected[k].getWeight() : 1;
+    }
+    Route* routes = new Route[count];
+    graph->findBestRoutes(locations.data(), destinations.data(), weights.data(), count, routes, now, *pool);
+
+    for (int k = 0; k < count; ++k) {
+        PackageExtended& package = affected[k];
+        int location = locations[k];
+
+        // Sem desvio o pacote volta à seção e espera a reabertura, se ainda houver alguma pendente
+        if (routes[k].path.getCurrentSize() < 2) {
+            if (pendingReopenings > 0) {
+                warehouses[location]->storePackage(package, package.peekRoute());
+            } else {
+                dropUndeliverable(package, location);
+            }
+            continue;
         }
+
+        package.saveRouteAsPrevious();
+        package.setRoute(routes[k].path);
+        package.advanceRoute();
+        package.updateLastRouteCalculation(now);
+        routeRecalculations++;
+
+        int nextWarehouseId = package.peekRoute();
+        warehouses[location]->storePackage(package, nextWarehouseId);
+        logPackageRestored(now, package.getId(), location, nextWarehouseId);
     }
 
-    delete[] lifoBuffer;
+    delete[] routes;
+}
+
+void SchedulerExtended::dropUndeliverable(PackageExtended& package, int location) {
+    package.setCurrentLocation(location);
+    package.setState(PackageState::UNDELIVERABLE);
+    logPackageUndeliverable(timer.getTime(), package.getId(), location);
+    undeliverablePackages++;
+    this->activePackages--;
+}
+
+bool SchedulerExtended::remainingRouteUsesClosedEdge(const PackageExtended& package, const GraphExtended* graph) const {
+    int remaining = package.getRemainingRouteSize();
+    for (int k = 0; k + 1 < remaining; ++k) {
+        if (graph->getEdgeInfo(package.peekRoute(k), package.peekRoute(k + 1)).isClosed) {
+            return true;
+        }
+    }
+    return false;
 }
 
 Event* SchedulerExtended::removeNextEvent() {
     return eventsHeap.extractMin();
 }
 
-void SchedulerExtended::calculateDynamicRoute(PackageExtended* package, GraphExtended* graph, int currentTime) {
+void SchedulerExtended::calculateDynamicRoute(PackageExtended& package, WarehouseExtended** warehouses, GraphExtended* graph, int currentTime) {
     if (!multipleRoutes) {
         return; // Apenas uma rota disponível
     }
 
-    int origin = package->getCurrentLocation();
-    int destination = package->getFinalDestination();
+    // O pacote está no início da rota atual (a localização registrada é o armazém anterior)
+    int origin = package.peekRoute();
+    int destination = package.getFinalDestination();
+
+    // Candidatas em ordem crescente de latência, calculadas sob demanda
+    KShortestPaths alternatives(*graph, origin, destination, package.getWeight());
+    Route candidate;
+    Route bestRoute;
+    int bestScore = INT_MAX;
+    int bestIndex = -1;
 
-    // Encontra melhor rota considerando peso e tempo atual
-    Route bestRoute = graph->findBestRoute(origin, destination, package->getWeight(), currentTime);
+    while (alternatives.getNumRoutesFound() < maxAlternativeRoutes && alternatives.nextRoute(candidate)) {
+        //* A penalidade é não negativa: nenhuma rota mais longa pode superar a melhor pontuação
+        if (candidate.totalLatency >= bestScore) {
+            break;
+        }
 
-    if (bestRoute.path.getCurrentSize() > 0) {
+        // Penalidade de congestionamento: partidas extras até esvaziar a fila da seção do próximo salto
+        int score = candidate.totalLatency;
+        if (candidate.path.getCurrentSize() > 1) {
+            int nextHop = candidate.path[1];
+            int queued = warehouses[origin]->getSectionSize(nextHop) + warehouses[origin]->getWaitingQueueSize(nextHop);
+            score += (queued / std::max(1, transportCapacity)) * transportInterval;
+        }
+
+        if (score < bestScore) {
+            bestScore = score;
+            bestIndex = alternatives.getNumRoutesFound() - 1;
+            bestRoute = candidate;
+        }
+    }
+
+    if (bestIndex >= 0) {
         // Adiciona rota atual ao histórico
-        package->addRouteToHistory(package->getRoute());
+        package.saveRouteAsPrevious();
 
         // Define nova rota
-        package->setRoute(std::move(bestRoute.path));
-        package->updateLastRouteCalculation(currentTime);
-        alternativeRoutesUsed++;
+        package.setRoute(bestRoute.path);
+        package.updateLastRouteCalculation(currentTime);
+        if (bestIndex > 0) {
+            alternativeRoutesUsed++;
+        }
     }
 }
 
-bool SchedulerExtended::shouldRecalculateRoute(PackageExtended* package, GraphExtended* graph, int currentTime) {
+bool SchedulerExtended::shouldRecalculateRoute(const PackageExtended& package, GraphExtended* graph, int currentTime) {
     // Suprime warning de parâmetro não usado
     (void)graph;
 
@@ -251,36 +537,42 @@ bool SchedulerExtended::shouldRecalculateRoute(PackageExtended* package, GraphEx
     // 2. Pacote requer manuseio especial
     // 3. Há congestionamento na rota atual
 
-    int timeSinceLastCalc = currentTime - package->getLastRouteCalculation();
+    int timeSinceLastCalc = currentTime - package.getLastRouteCalculation();
 
-    return (timeSinceLastCalc > 100) ||                                                                // Recalcula a cada 100 unidades de tempo
-           package->getRequiresSpecialHandling() || (package->getRouteHistory().getCurrentSize() > 3); // Muitas mudanças de rota
+    return (timeSinceLastCalc > 100) ||                                                          // Recalcula a cada 100 unidades de tempo
+           package.getRequiresSpecialHandling() || (package.getPreviousRouteSize() > 3); // Rota substituída ainda longa
 }
 
-void SchedulerExtended::handleCapacityOverflow(PackageExtended* package, WarehouseExtended** warehouses, int numWarehouses) {
-    int currentLocation = package->getCurrentLocation();
+void SchedulerExtended::handleCapacityOverflow(PackageExtended& package, WarehouseExtended** warehouses, int numWarehouses) {
+    int currentLocation = package.getCurrentLocation();
     WarehouseExtended* currentWarehouse = warehouses[currentLocation];
 
     // Estratégia 1: Tentar armazenamento secundário
-    if (currentWarehouse->transferToSecondaryStorage(package, package->getRoute().peekFront(), warehouses)) {
+    if (currentWarehouse->transferToSecondaryStorage(package, package.peekRoute(), warehouses)) {
         return;
     }
 
     // Estratégia 2: Encontrar armazém alternativo com capacidade
     for (int i = 0; i < numWarehouses; ++i) {
-        if (i != currentLocation && warehouses[i]->canStorePackage(package, package->getRoute().peekFront())) {
-            // Modifica rota para incluir armazém intermediário
-            LinkedList newRoute = package->getRoute();
-            newRoute.addFront(i);
-            package->setRoute(std::move(newRoute));
-            warehouses[i]->storePackage(package, package->getRoute().peekFront());
+        if (i != currentLocation && warehouses[i]->canStorePackage(package, package.peekRoute())) {
+            // Modifica rota para incluir armazém intermediário antes do restante da rota atual
+            RouteArena& arena = *routes;
+            int remaining = package.getRemainingRouteSize();
+            int* newRoute = new int[remaining + 1];
+            newRoute[0] = i;
+            for (int hop = 0; hop < remaining; ++hop) {
+                newRoute[hop + 1] = package.peekRoute(hop);
+            }
+            package.setRoute(arena.intern(newRoute, remaining + 1));
+            delete[] newRoute;
+            warehouses[i]->storePackage(package, package.peekRoute());
             alternativeRoutesUsed++;
             return;
         }
     }
 
     // Estratégia 3: Força armazenamento na fila de espera
-    currentWarehouse->storeInWaitingQueue(package, package->getRoute().peekFront());
+    currentWarehouse->storeInWaitingQueue(package, package.peekRoute());
 }
 
 int SchedulerExtended::calculateDynamicTransportCapacity(int origin, int destination, GraphExtended* graph) {
@@ -298,4 +590,8 @@ void SchedulerExtended::getSimulationMetrics(int& routeRecalc, int& capOverflow,
     capOverflow = capacityOverflows;
     weightOverflow = weightOverflows;
     altRoutes = alternativeRoutesUsed;
+}
+
+int SchedulerExtended::getUndeliverablePackages() const noexcept {
+    return undeliverablePackages;
 }
\ No newline at end of file
@@ -0,0 +1,695 @@
+#include "../../include/dataStructures/ContractionHierarchy.h"
+#include "../../include/dataStructures/GraphExtended.h"
+#include "../../include/utils/ThreadPool.h"
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+//@ Cabeçalho do arquivo binário da hierarquia
+const char CH_MAGIC[8] = {'T', 'P', '2', 'C', 'H', '\0', '\0', '\0'};
+const int CH_VERSION = 1;
+
+//@ Limite de vértices assentados por busca de testemunha (acima dele o atalho é mantido)
+const int WITNESS_SETTLE_LIMIT = 100;
+
+//@ Latência base de uma aresta: a latência de partida no tempo zero
+int baseLatency(const GraphExtended& graph, int i, int j) {
+    return graph.getLatencyAt(i, j, 0);
+}
+
+//@ Lista de adjacência dinâmica de um vértice durante a contração
+struct AdjacencyList {
+    int* target;
+    int* weight;
+    int* middle;
+    int size;
+    int capacity;
+
+    AdjacencyList() : target(nullptr), weight(nullptr), middle(nullptr), size(0), capacity(0) {}
+    ~AdjacencyList() {
+        delete[] target;
+        delete[] weight;
+        delete[] middle;
+    }
+
+    int find(int vertex) const {
+        for (int i = 0; i < size; ++i) {
+            if (target[i] == vertex) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void add(int vertex, int edgeWeight, int edgeMiddle) {
+        if (size == capacity) {
+            grow(capacity == 0 ? 4 : capacity * 2);
+        }
+        target[size] = vertex;
+        weight[size] = edgeWeight;
+        middle[size] = edgeMiddle;
+        size++;
+    }
+
+    //* Insere ou reduz o peso; em empate fica o menor intermediário, para a ordem de inserção não importar
+    void upsert(int vertex, int edgeWeight, int edgeMiddle) {
+        int i = find(vertex);
+        if (i == -1) {
+            add(vertex, edgeWeight, edgeMiddle);
+        } else if (edgeWeight < weight[i] || (edgeWeight == weight[i] && edgeMiddle < middle[i])) {
+            weight[i] = edgeWeight;
+            middle[i] = edgeMiddle;
+        }
+    }
+
+    void remove(int vertex) {
+        int i = find(vertex);
+        if (i != -1) {
+            size--;
+            target[i] = target[size];
+            weight[i] = weight[size];
+            middle[i] = middle[size];
+        }
+    }
+
+    void grow(int newCapacity) {
+        int* newTarget = new int[newCapacity];
+        int* newWeight = new int[newCapacity];
+        int* newMiddle = new int[newCapacity];
+        for (int i = 0; i < size; ++i) {
+            newTarget[i] = target[i];
+            newWeight[i] = weight[i];
+            newMiddle[i] = middle[i];
+        }
+        delete[] target;
+        delete[] weight;
+        delete[] middle;
+        target = newTarget;
+        weight = newWeight;
+        middle = newMiddle;
+        capacity = newCapacity;
+    }
+};
+
+//@ Atalhos gerados por uma thread em uma rodada de contração
+struct ShortcutList {
+    AdjacencyList from;
+    AdjacencyList edges;
+
+    void add(int u, int v, int edgeWeight, int edgeMiddle) {
+        from.add(u, 0, 0);
+        edges.add(v, edgeWeight, edgeMiddle);
+    }
+
+    int getSize() const { return from.size; }
+
+    void clear() {
+        from.size = 0;
+        edges.size = 0;
+    }
+};
+
+//@ Busca de testemunha (Dijkstra limitado) com vetores próprios de cada thread
+struct WitnessSearch {
+    int* dist;
+    int* touched;
+    int numTouched;
+    IndexedMinHeap heap;
+
+    WitnessSearch(int numVertices) : numTouched(0), heap(numVertices) {
+        dist = new int[numVertices];
+        touched = new int[numVertices];
+        for (int i = 0; i < numVertices; ++i) {
+            dist[i] = INT_MAX;
+        }
+    }
+    ~WitnessSearch() {
+        delete[] dist;
+        delete[] touched;
+    }
+
+    void run(const AdjacencyList* adjacency, int source, int excluded, const char* blocked, int maxDist) {
+        for (int i = 0; i < numTouched; ++i) {
+            dist[touched[i]] = INT_MAX;
+        }
+        numTouched = 0;
+        heap.clear();
+
+        dist[source] = 0;
+        touched[numTouched++] = source;
+        heap.pushOrDecrease(source, 0);
+
+        int settled = 0;
+        while (!heap.isEmpty()) {
+            int u = heap.extractMin();
+            int du = dist[u];
+            if (du > maxDist || ++settled > WITNESS_SETTLE_LIMIT) {
+                break;
+            }
+
+            const AdjacencyList& edges = adjacency[u];
+            for (int i = 0; i < edges.size; ++i) {
+                int v = edges.target[i];
+                if (v == excluded || (blocked != nullptr && blocked[v])) {
+                    continue;
+                }
+                int candidate = du + edges.weight[i];
+                if (candidate < dist[v]) {
+                    if (dist[v] == INT_MAX) {
+                        touched[numTouched++] = v;
+                    }
+                    dist[v] = candidate;
+                    heap.pushOrDecrease(v, candidate);
+                }
+            }
+        }
+    }
+};
+
+//@ Conta (e opcionalmente registra) os atalhos necessários para contrair u
+//@ Vértices bloqueados (contraídos na mesma rodada) não podem servir de testemunha
+int computeShortcuts(const AdjacencyList* adjacency, int u, const char* blocked, WitnessSearch& search, ShortcutList* out) {
+    const AdjacencyList& neighbors = adjacency[u];
+
+    int count = 0;
+    for (int i = 0; i + 1 < neighbors.size; ++i) {
+        int x = neighbors.target[i];
+        int weightX = neighbors.weight[i];
+
+        //* A busca só precisa cobrir o caminho mais longo via u até os vizinhos seguintes
+        int maxWeight = 0;
+        for (int j = i + 1; j < neighbors.size; ++j) {
+            if (neighbors.weight[j] > maxWeight) {
+                maxWeight = neighbors.weight[j];
+            }
+        }
+        search.run(adjacency, x, u, blocked, weightX + maxWeight);
+
+        for (int j = i + 1; j < neighbors.size; ++j) {
+            int y = neighbors.target[j];
+            int viaU = weightX + neighbors.weight[j];
+            if (search.dist[y] > viaU) {
+                count++;
+                if (out != nullptr) {
+                    out->add(x, y, viaU, u);
+                }
+            }
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+ContractionHierarchy::ContractionHierarchy(int numVertices)
+    : numVertices(numVertices), topologyHash(0), upTargets(nullptr), upWeights(nullptr), upMiddles(nullptr), numUpEdges(0), numShortcuts(0), forwardDist(nullptr), backwardDist(nullptr),
+      forwardParent(nullptr), backwardParent(nullptr), touched(nullptr), numTouched(0), forwardHeap(nullptr), backwardHeap(nullptr), pathBuffer(nullptr), chainBuffer(nullptr), pathLength(0) {
+    rank = new int[numVertices];
+    upOffsets = new int[numVertices + 1];
+}
+
+ContractionHierarchy::~ContractionHierarchy() {
+    delete[] rank;
+    delete[] upOffsets;
+    delete[] upTargets;
+    delete[] upWeights;
+    delete[] upMiddles;
+    delete[] forwardDist;
+    delete[] backwardDist;
+    delete[] forwardParent;
+    delete[] backwardParent;
+    delete[] touched;
+    delete forwardHeap;
+    delete backwardHeap;
+    delete[] pathBuffer;
+    delete[] chainBuffer;
+}
+
+void ContractionHierarchy::allocateQueryBuffers() {
+    forwardDist = new int[numVertices];
+    backwardDist = new int[numVertices];
+    forwardParent = new int[numVertices];
+    backwardParent = new int[numVertices];
+    touched = new int[numVertices];
+    pathBuffer = new int[numVertices];
+    chainBuffer = new int[numVertices];
+    for (int i = 0; i < numVertices; ++i) {
+        forwardDist[i] = INT_MAX;
+        backwardDist[i] = INT_MAX;
+        forwardParent[i] = -1;
+        backwardParent[i] = -1;
+    }
+    forwardHeap = new IndexedMinHeap(numVertices);
+    backwardHeap = new IndexedMinHeap(numVertices);
+}
+
+ContractionHierarchy* ContractionHierarchy::build(const GraphExtended& graph, int numThreads) {
+    ThreadPool pool(numThreads);
+    return build(graph, pool);
+}
+
+ContractionHierarchy* ContractionHierarchy::build(const GraphExtended& graph, ThreadPool& pool) {
+    int n = graph.getNumWarehouses();
+    if (n <= 0) {
+        throw std::invalid_argument("A hierarquia de contração precisa de um grafo não vazio.");
+    }
+
+    ContractionHierarchy* ch = new ContractionHierarchy(n);
+    ch->topologyHash = computeTopologyHash(graph);
+
+    // Grafo de trabalho, reduzido a cada rodada de contração
+    AdjacencyList* adjacency = new AdjacencyList[n];
+    for (int i = 0; i < n; ++i) {
+        for (int j : graph.neighbors(i)) {
+            if (i != j) {
+                adjacency[i].upsert(j, baseLatency(graph, i, j), -1);
+            }
+        }
+    }
+
+    int numWorkers = pool.getNumThreads();
+    WitnessSearch** searches = new WitnessSearch*[numWorkers];
+    for (int t = 0; t < numWorkers; ++t) {
+        searches[t] = new WitnessSearch(n);
+    }
+    ShortcutList* shortcuts = new ShortcutList[numWorkers];
+
+    AdjacencyList* upward = new AdjacencyList[n];
+    int* priority = new int[n];
+    int* deletedNeighbors = new int[n];
+    int* remaining = new int[n];
+    int* independent = new int[n];
+    int* affected = new int[n];
+    char* inSet = new char[n];
+    char* affectedMark = new char[n];
+    for (int i = 0; i < n; ++i) {
+        deletedNeighbors[i] = 0;
+        remaining[i] = i;
+        inSet[i] = 0;
+        affectedMark[i] = 0;
+    }
+    int numRemaining = n;
+
+    // Prioridade: diferença de arestas mais vizinhos já contraídos
+    auto updatePriority = [&](int u, int worker) { priority[u] = computeShortcuts(adjacency, u, nullptr, *searches[worker], nullptr) - adjacency[u].size + deletedNeighbors[u]; };
+    pool.parallelFor(0, n, updatePriority);
+
+    int nextRank = 0;
+    while (numRemaining > 0) {
+        // Conjunto independente: vértices com prioridade mínima (desempate por ID) na vizinhança
+        int numIndependent = 0;
+        for (int k = 0; k < numRemaining; ++k) {
+            int u = remaining[k];
+            bool isLocalMin = true;
+            for (int i = 0; i < adjacency[u].size && isLocalMin; ++i) {
+                int v = adjacency[u].target[i];
+                isLocalMin = priority[u] < priority[v] || (priority[u] == priority[v] && u < v);
+            }
+            if (isLocalMin) {
+                independent[numIndependent++] = u;
+                inSet[u] = 1;
+            }
+        }
+
+        // Contração paralela: cada thread acumula seus atalhos
+        for (int t = 0; t < numWorkers; ++t) {
+            shortcuts[t].clear();
+        }
+        pool.parallelFor(0, numIndependent, [&](int k, int worker) { computeShortcuts(adjacency, independent[k], inSet, *searches[worker], &shortcuts[worker]); });
+
+        // Remove os vértices contraídos; suas arestas restantes apontam para ranks maiores
+        int numAffected = 0;
+        for (int k = 0; k < numIndependent; ++k) {
+            int u = independent[k];
+            ch->rank[u] = nextRank++;
+
+            AdjacencyList& edges = adjacency[u];
+            for (int i = 0; i < edges.size; ++i) {
+                int v = edges.target[i];
+                upward[u].add(v, edges.weight[i], edges.middle[i]);
+                adjacency[v].remove(u);
+                deletedNeighbors[v]++;
+                if (!affectedMark[v]) {
+                    affectedMark[v] = 1;
+                    affected[numAffected++] = v;
+                }
+            }
+            edges.size = 0;
+        }
+
+        for (int t = 0; t < numWorkers; ++t) {
+            for (int s = 0; s < shortcuts[t].getSize(); ++s) {
+                int u = shortcuts[t].from.target[s];
+                int v = shortcuts[t].edges.target[s];
+                int weight = shortcuts[t].edges.weight[s];
+                int middle = shortcuts[t].edges.middle[s];
+                adjacency[u].upsert(v, weight, middle);
+                adjacency[v].upsert(u, weight, middle);
+            }
+        }
+
+        int kept = 0;
+        for (int k = 0; k < numRemaining; ++k) {
+            if (!inSet[remaining[k]]) {
+                remaining[kept++] = remaining[k];
+            }
+        }
+        numRemaining = kept;
+        for (int k = 0; k < numIndependent; ++k) {
+            inSet[independent[k]] = 0;
+        }
+
+        pool.parallelFor(0, numAffected, [&](int k, int worker) { updatePriority(affected[k], worker); });
+        for (int k = 0; k < numAffected; ++k) {
+            affectedMark[affected[k]] = 0;
+        }
+    }
+
+    // Converte o grafo ascendente para CSR
+    ch->upOffsets[0] = 0;
+    for (int u = 0; u < n; ++u) {
+        ch->upOffsets[u + 1] = ch->upOffsets[u] + upward[u].size;
+    }
+    ch->numUpEdges = ch->upOffsets[n];
+    ch->upTargets = new int[ch->numUpEdges];
+    ch->upWeights = new int[ch->numUpEdges];
+    ch->upMiddles = new int[ch->numUpEdges];
+    for (int u = 0; u < n; ++u) {
+        for (int i = 0; i < upward[u].size; ++i) {
+            int e = ch->upOffsets[u] + i;
+            ch->upTargets[e] = upward[u].target[i];
+            ch->upWeights[e] = upward[u].weight[i];
+            ch->upMiddles[e] = upward[u].middle[i];
+            if (upward[u].middle[i] != -1) {
+                ch->numShortcuts++;
+            }
+        }
+    }
+    ch->allocateQueryBuffers();
+
+    for (int t = 0; t < numWorkers; ++t) {
+        delete searches[t];
+    }
+    delete[] searches;
+    delete[] shortcuts;
+    delete[] adjacency;
+    delete[] upward;
+    delete[] priority;
+    delete[] deletedNeighbors;
+    delete[] remaining;
+    delete[] independent;
+    delete[] affected;
+    delete[] inSet;
+    delete[] affectedMark;
+
+    return ch;
+}
+
+ContractionHierarchy* ContractionHierarchy::loadFromFile(const std::string& filename, const GraphExtended& graph) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return nullptr;
+    }
+
+    char magic[8];
+    int version = 0;
+    int n = 0;
+    unsigned long long hash = 0;
+    int numEdges = 0;
+    int shortcutCount = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&n), sizeof(n));
+    file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    file.read(reinterpret_cast<char*>(&numEdges), sizeof(numEdges));
+    file.read(reinterpret_cast<char*>(&shortcutCount), sizeof(shortcutCount));
+
+    //* Arquivo de outra versão ou de outra topologia é ignorado (o chamador reconstrói)
+    if (!file || std::memcmp(magic, CH_MAGIC, sizeof(magic)) != 0 || version != CH_VERSION || n != graph.getNumWarehouses() || n <= 0 || numEdges < 0 ||
+        shortcutCount < 0 || shortcutCount > numEdges || hash != computeTopologyHash(graph)) {
+        return nullptr;
+    }
+
+    //* O restante do arquivo deve ter exatamente os vetores anunciados no cabeçalho (antes de alocá-los)
+    std::streampos dataStart = file.tellg();
+    file.seekg(0, std::ios::end);
+    long long remaining = static_cast<long long>(file.tellg() - dataStart);
+    file.seekg(dataStart);
+    if (remaining != static_cast<long long>(sizeof(int)) * (2LL * n + 1 + 3LL * numEdges)) {
+        return nullptr;
+    }
+
+    ContractionHierarchy* ch = new ContractionHierarchy(n);
+    ch->topologyHash = hash;
+    ch->numUpEdges = numEdges;
+    ch->numShortcuts = shortcutCount;
+    ch->upTargets = new int[numEdges];
+    ch->upWeights = new int[numEdges];
+    ch->upMiddles = new int[numEdges];
+
+    file.read(reinterpret_cast<char*>(ch->rank), sizeof(int) * n);
+    file.read(reinterpret_cast<char*>(ch->upOffsets), sizeof(int) * (n + 1));
+    file.read(reinterpret_cast<char*>(ch->upTargets), sizeof(int) * numEdges);
+    file.read(reinterpret_cast<char*>(ch->upWeights), sizeof(int) * numEdges);
+    file.read(reinterpret_cast<char*>(ch->upMiddles), sizeof(int) * numEdges);
+
+    if (!file || !ch->hasValidStructure()) {
+        delete ch;
+        return nullptr;
+    }
+
+    ch->allocateQueryBuffers();
+    return ch;
+}
+
+bool ContractionHierarchy::hasValidStructure() const noexcept {
+    int n = numVertices;
+    bool* seen = new bool[n]();
+    bool valid = true;
+    for (int u = 0; u < n && valid; ++u) {
+        valid = rank[u] >= 0 && rank[u] < n && !seen[rank[u]];
+        if (valid) {
+            seen[rank[u]] = true;
+        }
+    }
+    delete[] seen;
+
+    valid = valid && upOffsets[0] == 0 && upOffsets[n] == numUpEdges;
+    for (int u = 0; u < n && valid; ++u) {
+        valid = upOffsets[u] <= upOffsets[u + 1];
+    }
+
+    int shortcuts = 0;
+    for (int u = 0; u < n && valid; ++u) {
+        for (int e = upOffsets[u]; e < upOffsets[u + 1] && valid; ++e) {
+            int v = upTargets[e];
+            int middle = upMiddles[e];
+            valid = v >= 0 && v < n && rank[v] > rank[u] && upWeights[e] >= 0 && (middle == -1 || (middle >= 0 && middle < n && rank[middle] < rank[u]));
+            shortcuts += middle != -1;
+        }
+    }
+    if (!valid || shortcuts != numShortcuts) {
+        return false;
+    }
+
+    //* Cada atalho (u, v) via middle substitui as arestas (middle, u) e (middle, v), e pesa a soma delas
+    for (int u = 0; u < n; ++u) {
+        for (int e = upOffsets[u]; e < upOffsets[u + 1]; ++e) {
+            int middle = upMiddles[e];
+            if (middle == -1) {
+                continue;
+            }
+            int toU = findUpwardEdge(middle, u);
+            int toV = findUpwardEdge(middle, upTargets[e]);
+            if (toU == -1 || toV == -1 || static_cast<long long>(upWeights[toU]) + upWeights[toV] != upWeights[e]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ContractionHierarchy::saveToFile(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    file.write(CH_MAGIC, sizeof(CH_MAGIC));
+    file.write(reinterpret_cast<const char*>(&CH_VERSION), sizeof(CH_VERSION));
+    file.write(reinterpret_cast<const char*>(&numVertices), sizeof(numVertices));
+    file.write(reinterpret_cast<const char*>(&topologyHash), sizeof(topologyHash));
+    file.write(reinterpret_cast<const char*>(&numUpEdges), sizeof(numUpEdges));
+    file.write(reinterpret_cast<const char*>(&numShortcuts), sizeof(numShortcuts));
+    file.write(reinterpret_cast<const char*>(rank), sizeof(int) * numVertices);
+    file.write(reinterpret_cast<const char*>(upOffsets), sizeof(int) * (numVertices + 1));
+    file.write(reinterpret_cast<const char*>(upTargets), sizeof(int) * numUpEdges);
+    file.write(reinterpret_cast<const char*>(upWeights), sizeof(int) * numUpEdges);
+    file.write(reinterpret_cast<const char*>(upMiddles), sizeof(int) * numUpEdges);
+
+    return static_cast<bool>(file);
+}
+
+unsigned long long ContractionHierarchy::computeTopologyHash(const GraphExtended& graph) {
+    unsigned long long hash = 14695981039346656037ULL;
+    auto mix = [&hash](int value) {
+        for (int byte = 0; byte < 4; ++byte) {
+            hash ^= static_cast<unsigned long long>((value >> (8 * byte)) & 0xFF);
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    int n = graph.getNumWarehouses();
+    mix(n);
+    for (int i = 0; i < n; ++i) {
+        for (int j : graph.neighbors(i)) {
+            if (j > i) {
+                mix(i);
+                mix(j);
+                mix(baseLatency(graph, i, j));
+            }
+        }
+    }
+    return hash;
+}
+
+int ContractionHierarchy::getNumVertices() const noexcept {
+    return numVertices;
+}
+
+int ContractionHierarchy::getNumShortcuts() const noexcept {
+    return numShortcuts;
+}
+
+unsigned long long ContractionHierarchy::getTopologyHash() const noexcept {
+    return topologyHash;
+}
+
+int ContractionHierarchy::query(int origin, int destination) {
+    pathLength = 0;
+    if (origin < 0 || origin >= numVertices || destination < 0 || destination >= numVertices) {
+        return INT_MAX;
+    }
+    if (origin == destination) {
+        pathBuffer[pathLength++] = origin;
+        return 0;
+    }
+
+    // Limpa apenas o que a consulta anterior tocou
+    for (int k = 0; k < numTouched; ++k) {
+        int v = touched[k];
+        forwardDist[v] = INT_MAX;
+        backwardDist[v] = INT_MAX;
+        forwardParent[v] = -1;
+        backwardParent[v] = -1;
+    }
+    numTouched = 0;
+    forwardHeap->clear();
+    backwardHeap->clear();
+
+    touch(origin);
+    forwardDist[origin] = 0;
+    forwardHeap->pushOrDecrease(origin, 0);
+    touch(destination);
+    backwardDist[destination] = 0;
+    backwardHeap->pushOrDecrease(destination, 0);
+
+    // Busca bidirecional ascendente; para quando nenhuma fila pode melhorar o melhor encontro
+    int best = INT_MAX;
+    int meeting = -1;
+    while (true) {
+        int minForward = forwardHeap->isEmpty() ? INT_MAX : forwardHeap->peekMinKey();
+        int minBackward = backwardHeap->isEmpty() ? INT_MAX : backwardHeap->peekMinKey();
+        if (minForward >= best && minBackward >= best) {
+            break;
+        }
+
+        bool forward = minForward <= minBackward;
+        IndexedMinHeap* heap = forward ? forwardHeap : backwardHeap;
+        int* dist = forward ? forwardDist : backwardDist;
+        int* parent = forward ? forwardParent : backwardParent;
+        const int* otherDist = forward ? backwardDist : forwardDist;
+
+        int u = heap->extractMin();
+        int du = dist[u];
+        if (otherDist[u] != INT_MAX && du + otherDist[u] < best) {
+            best = du + otherDist[u];
+            meeting = u;
+        }
+
+        for (int e = upOffsets[u]; e < upOffsets[u + 1]; ++e) {
+            int v = upTargets[e];
+            int candidate = du + upWeights[e];
+            if (candidate < dist[v]) {
+                if (forwardDist[v] == INT_MAX && backwardDist[v] == INT_MAX) {
+                    touch(v);
+                }
+                dist[v] = candidate;
+                parent[v] = u;
+                heap->pushOrDecrease(v, candidate);
+            }
+        }
+    }
+
+    if (meeting == -1) {
+        return INT_MAX;
+    }
+
+    // Metade direta: do encontro até a origem, percorrida depois na ordem inversa
+    int chainLength = 0;
+    for (int v = meeting; v != -1; v = forwardParent[v]) {
+        chainBuffer[chainLength++] = v;
+    }
+    pathBuffer[pathLength++] = origin;
+    for (int k = chainLength - 1; k > 0; --k) {
+        unpackEdge(chainBuffer[k], chainBuffer[k - 1]);
+    }
+
+    // Metade reversa: do encontro até o destino
+    for (int v = meeting; backwardParent[v] != -1; v = backwardParent[v]) {
+        unpackEdge(v, backwardParent[v]);
+    }
+
+    return best;
+}
+
+const int* ContractionHierarchy::getPath() const noexcept {
+    return pathBuffer;
+}
+
+int ContractionHierarchy::getPathLength() const noexcept {
+    return pathLength;
+}
+
+int ContractionHierarchy::findUpwardEdge(int u, int v) const noexcept {
+    int low = rank[u] < rank[v] ? u : v;
+    int high = low == u ? v : u;
+    for (int e = upOffsets[low]; e < upOffsets[low + 1]; ++e) {
+        if (upTargets[e] == high) {
+            return e;
+        }
+    }
+    return -1;
+}
+
+void ContractionHierarchy::unpackEdge(int from, int to) {
+    int e = findUpwardEdge(from, to);
+    int middle = e == -1 ? -1 : upMiddles[e];
+
+    //* Atalho (from, to) via middle vira (from, middle) + (middle, to); middle tem rank menor que ambos
+    if (middle == -1) {
+        if (pathLength < numVertices) {
+            pathBuffer[pathLength++] = to;
+        }
+        return;
+    }
+    unpackEdge(from, middle);
+    unpackEdge(middle, to);
+}
+
+void ContractionHierarchy::touch(int vertex) noexcept {
+    touched[numTouched++] = vertex;
+}
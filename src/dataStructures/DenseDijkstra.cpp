@@ -0,0 +1,279 @@
+#include "../../include/dataStructures/DenseDijkstra.h"
+#include <new>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DENSE_DIJKSTRA_X86 1
+#endif
+
+namespace {
+
+//@ Assinaturas dos kernels de escolha do mínimo e de relaxamento de uma linha
+typedef int (*ArgMinKernel)(const int* key, int stride);
+typedef void (*RelaxKernel)(const int* row, const int* visited, int du, int u, double weightFactor, int* key, int* parent, int stride);
+
+// --- Kernels escalares (fallback) ---
+
+int argMinScalar(const int* key, int stride) {
+    int best = INT_MAX;
+    int bestIndex = -1;
+    for (int v = 0; v < stride; ++v) {
+        if (key[v] < best) {
+            best = key[v];
+            bestIndex = v;
+        }
+    }
+    return bestIndex;
+}
+
+void relaxScalar(const int* row, const int* visited, int du, int u, double weightFactor, int* key, int* parent, int stride) {
+    for (int v = 0; v < stride; ++v) {
+        if (row[v] == DenseDijkstra::NO_EDGE || visited[v]) {
+            continue;
+        }
+        int cost = static_cast<int>(row[v] * weightFactor);
+        if (du + cost < key[v]) {
+            key[v] = du + cost;
+            parent[v] = u;
+        }
+    }
+}
+
+#ifdef DENSE_DIJKSTRA_X86
+
+// --- Kernels AVX2 (8 inteiros por iteração) ---
+
+__attribute__((target("avx2"))) int argMinAvx2(const int* key, int stride) {
+    __m256i best = _mm256_set1_epi32(INT_MAX);
+    __m256i bestIndex = _mm256_setzero_si256();
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+
+    //* Cada lane guarda o primeiro índice de menor valor entre os índices congruentes a ela
+    for (int v = 0; v < stride; v += 8) {
+        __m256i values = _mm256_load_si256(reinterpret_cast<const __m256i*>(key + v));
+        __m256i less = _mm256_cmpgt_epi32(best, values);
+        best = _mm256_blendv_epi8(best, values, less);
+        bestIndex = _mm256_blendv_epi8(bestIndex, index, less);
+        index = _mm256_add_epi32(index, step);
+    }
+
+    alignas(32) int lanes[8];
+    alignas(32) int laneIndex[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), best);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(laneIndex), bestIndex);
+
+    //* Redução horizontal: menor valor e, em caso de empate, menor índice
+    int result = -1;
+    int resultValue = INT_MAX;
+    for (int lane = 0; lane < 8; ++lane) {
+        if (lanes[lane] < resultValue || (lanes[lane] == resultValue && resultValue != INT_MAX && laneIndex[lane] < result)) {
+            resultValue = lanes[lane];
+            result = laneIndex[lane];
+        }
+    }
+    return result;
+}
+
+__attribute__((target("avx2"))) void relaxAvx2(const int* row, const int* visited, int du, int u, double weightFactor, int* key, int* parent, int stride) {
+    const __m256i noEdge = _mm256_set1_epi32(DenseDijkstra::NO_EDGE);
+    const __m256i distance = _mm256_set1_epi32(du);
+    const __m256i predecessor = _mm256_set1_epi32(u);
+    const __m256d factor = _mm256_set1_pd(weightFactor);
+    const bool scaled = weightFactor != 1.0;
+
+    for (int v = 0; v < stride; v += 8) {
+        __m256i latency = _mm256_load_si256(reinterpret_cast<const __m256i*>(row + v));
+        __m256i blocked = _mm256_or_si256(_mm256_cmpeq_epi32(latency, noEdge), _mm256_load_si256(reinterpret_cast<const __m256i*>(visited + v)));
+        if (_mm256_movemask_epi8(blocked) == -1) {
+            continue;
+        }
+
+        //* Aplica o fator de peso em dupla precisão, com o mesmo truncamento da versão escalar
+        if (scaled) {
+            __m128i low = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(latency)), factor));
+            __m128i high = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(latency, 1)), factor));
+            latency = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+        }
+
+        __m256i candidate = _mm256_add_epi32(distance, latency);
+        __m256i current = _mm256_load_si256(reinterpret_cast<const __m256i*>(key + v));
+        __m256i improve = _mm256_andnot_si256(blocked, _mm256_cmpgt_epi32(current, candidate));
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(key + v), _mm256_blendv_epi8(current, candidate, improve));
+        __m256i parents = _mm256_load_si256(reinterpret_cast<const __m256i*>(parent + v));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(parent + v), _mm256_blendv_epi8(parents, predecessor, improve));
+    }
+}
+
+// --- Kernels SSE4.1 (4 inteiros por iteração) ---
+
+__attribute__((target("sse4.1"))) int argMinSse41(const int* key, int stride) {
+    __m128i best = _mm_set1_epi32(INT_MAX);
+    __m128i bestIndex = _mm_setzero_si128();
+    __m128i index = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i step = _mm_set1_epi32(4);
+
+    for (int v = 0; v < stride; v += 4) {
+        __m128i values = _mm_load_si128(reinterpret_cast<const __m128i*>(key + v));
+        __m128i less = _mm_cmpgt_epi32(best, values);
+        best = _mm_blendv_epi8(best, values, less);
+        bestIndex = _mm_blendv_epi8(bestIndex, index, less);
+        index = _mm_add_epi32(index, step);
+    }
+
+    alignas(16) int lanes[4];
+    alignas(16) int laneIndex[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), best);
+    _mm_store_si128(reinterpret_cast<__m128i*>(laneIndex), bestIndex);
+
+    int result = -1;
+    int resultValue = INT_MAX;
+    for (int lane = 0; lane < 4; ++lane) {
+        if (lanes[lane] < resultValue || (lanes[lane] == resultValue && resultValue != INT_MAX && laneIndex[lane] < result)) {
+            resultValue = lanes[lane];
+            result = laneIndex[lane];
+        }
+    }
+    return result;
+}
+
+__attribute__((target("sse4.1"))) void relaxSse41(const int* row, const int* visited, int du, int u, double weightFactor, int* key, int* parent, int stride) {
+    const __m128i noEdge = _mm_set1_epi32(DenseDijkstra::NO_EDGE);
+    const __m128i distance = _mm_set1_epi32(du);
+    const __m128i predecessor = _mm_set1_epi32(u);
+    const __m128d factor = _mm_set1_pd(weightFactor);
+    const bool scaled = weightFactor != 1.0;
+
+    for (int v = 0; v < stride; v += 4) {
+        __m128i latency = _mm_load_si128(reinterpret_cast<const __m128i*>(row + v));
+        __m128i blocked = _mm_or_si128(_mm_cmpeq_epi32(latency, noEdge), _mm_load_si128(reinterpret_cast<const __m128i*>(visited + v)));
+        if (_mm_movemask_epi8(blocked) == 0xFFFF) {
+            continue;
+        }
+
+        if (scaled) {
+            __m128i low = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(latency), factor));
+            __m128i high = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(latency, 8)), factor));
+            latency = _mm_unpacklo_epi64(low, high);
+        }
+
+        __m128i candidate = _mm_add_epi32(distance, latency);
+        __m128i current = _mm_load_si128(reinterpret_cast<const __m128i*>(key + v));
+        __m128i improve = _mm_andnot_si128(blocked, _mm_cmpgt_epi32(current, candidate));
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(key + v), _mm_blendv_epi8(current, candidate, improve));
+        __m128i parents = _mm_load_si128(reinterpret_cast<const __m128i*>(parent + v));
+        _mm_store_si128(reinterpret_cast<__m128i*>(parent + v), _mm_blendv_epi8(parents, predecessor, improve));
+    }
+}
+
+#endif
+
+//@ Estrutura que guarda os kernels escolhidos para a CPU atual
+struct KernelSet {
+    ArgMinKernel argMin;
+    RelaxKernel relax;
+    const char* name;
+};
+
+//@ Escolhe os kernels uma única vez, de acordo com as extensões suportadas pela CPU
+const KernelSet& selectKernels() {
+    static const KernelSet kernels = []() {
+#ifdef DENSE_DIJKSTRA_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return KernelSet{argMinAvx2, relaxAvx2, "avx2"};
+        }
+        if (__builtin_cpu_supports("sse4.1")) {
+            return KernelSet{argMinSse41, relaxSse41, "sse4.1"};
+        }
+#endif
+        return KernelSet{argMinScalar, relaxScalar, "scalar"};
+    }();
+    return kernels;
+}
+
+} // namespace
+
+DenseDijkstra::DenseDijkstra(int numVertices) : numVertices(numVertices), stride(rowStride(numVertices)) {
+    if (numVertices <= 0) {
+        throw std::invalid_argument("O número de vértices do DenseDijkstra deve ser positivo.");
+    }
+    key = allocateAligned(stride);
+    dist = allocateAligned(stride);
+    parent = allocateAligned(stride);
+    visited = allocateAligned(stride);
+}
+
+DenseDijkstra::~DenseDijkstra() {
+    freeAligned(key);
+    freeAligned(dist);
+    freeAligned(parent);
+    freeAligned(visited);
+}
+
+void DenseDijkstra::run(const int* latencyMatrix, int origin, double weightFactor) {
+    const KernelSet& kernels = selectKernels();
+
+    for (int v = 0; v < stride; ++v) {
+        key[v] = INT_MAX;
+        dist[v] = INT_MAX;
+        parent[v] = -1;
+        visited[v] = 0;
+    }
+    key[origin] = 0;
+
+    //* Mesmo número de extrações da versão escalar original (V - 1)
+    for (int count = 0; count < numVertices - 1; ++count) {
+        int u = kernels.argMin(key, stride);
+        if (u == -1) {
+            break;
+        }
+
+        int du = key[u];
+        dist[u] = du;
+        key[u] = INT_MAX;
+        visited[u] = -1;
+
+        kernels.relax(latencyMatrix + static_cast<size_t>(u) * stride, visited, du, u, weightFactor, key, parent, stride);
+    }
+
+    //* Vértices não extraídos mantêm a distância tentativa (o último deles já é final)
+    for (int v = 0; v < numVertices; ++v) {
+        if (!visited[v]) {
+            dist[v] = key[v];
+        }
+    }
+}
+
+int DenseDijkstra::getDistance(int vertex) const noexcept {
+    if (vertex < 0 || vertex >= numVertices) {
+        return INT_MAX;
+    }
+    return dist[vertex];
+}
+
+int DenseDijkstra::getParent(int vertex) const noexcept {
+    if (vertex < 0 || vertex >= numVertices) {
+        return -1;
+    }
+    return parent[vertex];
+}
+
+int DenseDijkstra::rowStride(int numVertices) noexcept {
+    return (numVertices + 7) & ~7;
+}
+
+int* DenseDijkstra::allocateAligned(size_t count) {
+    return static_cast<int*>(::operator new[](count * sizeof(int), std::align_val_t(ALIGNMENT)));
+}
+
+void DenseDijkstra::freeAligned(int* data) noexcept {
+    ::operator delete[](data, std::align_val_t(ALIGNMENT));
+}
+
+const char* DenseDijkstra::getKernelName() noexcept {
+    return selectKernels().name;
+}
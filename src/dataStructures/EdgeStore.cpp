@@ -0,0 +1,251 @@
+#include "../../include/dataStructures/EdgeStore.h"
+#include <new>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define EDGE_STORE_X86 1
+#endif
+
+namespace {
+
+//@ Alinhamento dos vetores de atributos (uma linha de cache)
+const size_t EDGE_ALIGNMENT = 64;
+
+template <typename T>
+T* allocateArray(int count) {
+    return static_cast<T*>(::operator new[](static_cast<size_t>(count) * sizeof(T), std::align_val_t(EDGE_ALIGNMENT)));
+}
+
+template <typename T>
+void freeArray(T* data) noexcept {
+    ::operator delete[](data, std::align_val_t(EDGE_ALIGNMENT));
+}
+
+//@ Assinatura dos kernels de latência senoidal de uma linha
+typedef void (*RowKernel)(const int* base, const double* multiplier, double timeFactor, int* out, int count);
+
+//* Mesma ordem de operações de GraphExtended::evaluateLatency (base * multiplicador * fator), para resultados idênticos
+void evaluateRowScalar(const int* base, const double* multiplier, double timeFactor, int* out, int count) {
+    for (int k = 0; k < count; ++k) {
+        out[k] = static_cast<int>(base[k] * multiplier[k] * timeFactor);
+    }
+}
+
+#ifdef EDGE_STORE_X86
+
+// --- AVX2 (4 arestas por iteração) ---
+
+__attribute__((target("avx2"))) void evaluateRowAvx2(const int* base, const double* multiplier, double timeFactor, int* out, int count) {
+    __m256d factor = _mm256_set1_pd(timeFactor);
+    int k = 0;
+    for (; k + 4 <= count; k += 4) {
+        __m256d latency = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i*>(base + k)));
+        latency = _mm256_mul_pd(_mm256_mul_pd(latency, _mm256_loadu_pd(multiplier + k)), factor);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k), _mm256_cvttpd_epi32(latency));
+    }
+    evaluateRowScalar(base + k, multiplier + k, timeFactor, out + k, count - k);
+}
+
+// --- SSE2 (2 arestas por iteração) ---
+
+void evaluateRowSse2(const int* base, const double* multiplier, double timeFactor, int* out, int count) {
+    __m128d factor = _mm_set1_pd(timeFactor);
+    int k = 0;
+    for (; k + 2 <= count; k += 2) {
+        __m128d latency = _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(base + k)));
+        latency = _mm_mul_pd(_mm_mul_pd(latency, _mm_loadu_pd(multiplier + k)), factor);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + k), _mm_cvttpd_epi32(latency));
+    }
+    evaluateRowScalar(base + k, multiplier + k, timeFactor, out + k, count - k);
+}
+
+#endif
+
+//@ Escolhe o kernel uma única vez, de acordo com as extensões suportadas pela CPU
+RowKernel selectRowKernel() {
+    static const RowKernel kernel = []() {
+#ifdef EDGE_STORE_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return evaluateRowAvx2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return evaluateRowSse2;
+        }
+#endif
+        return evaluateRowScalar;
+    }();
+    return kernel;
+}
+
+} // namespace
+
+EdgeStore::EdgeStore(int numVertices) : numVertices(numVertices), usedSlots(0), slotCapacity(0) {
+    rowStart = new int[numVertices];
+    rowDegree = new int[numVertices];
+    rowCapacity = new int[numVertices];
+    for (int i = 0; i < numVertices; ++i) {
+        rowStart[i] = 0;
+        rowDegree[i] = 0;
+        rowCapacity[i] = 0;
+    }
+
+    targets = allocateArray<int>(0);
+    capacities = allocateArray<int>(0);
+    baseLatencies = allocateArray<int>(0);
+    multipliers = allocateArray<double>(0);
+    profileIndices = allocateArray<int>(0);
+    flags = allocateArray<unsigned char>(0);
+}
+
+EdgeStore::~EdgeStore() {
+    delete[] rowStart;
+    delete[] rowDegree;
+    delete[] rowCapacity;
+    freeArray(targets);
+    freeArray(capacities);
+    freeArray(baseLatencies);
+    freeArray(multipliers);
+    freeArray(profileIndices);
+    freeArray(flags);
+}
+
+int EdgeStore::find(int i, int j) const noexcept {
+    int low = rowStart[i];
+    int high = rowStart[i] + rowDegree[i];
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (targets[mid] < j) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < rowStart[i] + rowDegree[i] && targets[low] == j ? low : -1;
+}
+
+int EdgeStore::insert(int i, int j) {
+    int existing = find(i, j);
+    if (existing != -1) {
+        return existing;
+    }
+
+    reserveInRow(i);
+
+    // Desloca as arestas de vizinhos maiores uma posição para a direita
+    int begin = rowStart[i];
+    int slot = begin + rowDegree[i];
+    while (slot > begin && targets[slot - 1] > j) {
+        targets[slot] = targets[slot - 1];
+        capacities[slot] = capacities[slot - 1];
+        baseLatencies[slot] = baseLatencies[slot - 1];
+        multipliers[slot] = multipliers[slot - 1];
+        profileIndices[slot] = profileIndices[slot - 1];
+        flags[slot] = flags[slot - 1];
+        slot--;
+    }
+
+    targets[slot] = j;
+    capacities[slot] = 0;
+    baseLatencies[slot] = 0;
+    multipliers[slot] = 1.0;
+    profileIndices[slot] = -1;
+    flags[slot] = 0;
+    rowDegree[i]++;
+    return slot;
+}
+
+void EdgeStore::compact() {
+    int numEdges = 0;
+    for (int i = 0; i < numVertices; ++i) {
+        numEdges += rowDegree[i];
+    }
+    relayout(numEdges, -1, 0);
+}
+
+void EdgeStore::evaluateRow(int i, double timeFactor, int* out) const noexcept {
+    selectRowKernel()(baseLatencies + rowStart[i], multipliers + rowStart[i], timeFactor, out, rowDegree[i]);
+}
+
+void EdgeStore::reserveInRow(int i) {
+    if (rowDegree[i] < rowCapacity[i]) {
+        return;
+    }
+
+    int newCapacity = rowCapacity[i] == 0 ? 4 : rowCapacity[i] * 2;
+    int extra = newCapacity - rowCapacity[i];
+
+    // Última linha dos vetores: cresce no próprio lugar
+    if (rowCapacity[i] > 0 && rowStart[i] + rowCapacity[i] == usedSlots && usedSlots + extra <= slotCapacity) {
+        rowCapacity[i] = newCapacity;
+        usedSlots += extra;
+        return;
+    }
+
+    // Há espaço no fim: a linha é movida para lá (o trecho antigo vira buraco até o próximo relayout)
+    if (usedSlots + newCapacity <= slotCapacity) {
+        int from = rowStart[i];
+        int to = usedSlots;
+        for (int k = 0; k < rowDegree[i]; ++k) {
+            targets[to + k] = targets[from + k];
+            capacities[to + k] = capacities[from + k];
+            baseLatencies[to + k] = baseLatencies[from + k];
+            multipliers[to + k] = multipliers[from + k];
+            profileIndices[to + k] = profileIndices[from + k];
+            flags[to + k] = flags[from + k];
+        }
+        rowStart[i] = to;
+        rowCapacity[i] = newCapacity;
+        usedSlots += newCapacity;
+        return;
+    }
+
+    // Sem espaço: reorganiza tudo, deixando o dobro das arestas vivas de espaço para crescer
+    int numEdges = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        numEdges += rowDegree[v];
+    }
+    int total = 2 * (numEdges + newCapacity);
+    relayout(total < 64 ? 64 : total, i, newCapacity);
+}
+
+void EdgeStore::relayout(int newSlotCapacity, int growRow, int growCapacity) {
+    int* newTargets = allocateArray<int>(newSlotCapacity);
+    int* newCapacities = allocateArray<int>(newSlotCapacity);
+    int* newLatencies = allocateArray<int>(newSlotCapacity);
+    double* newMultipliers = allocateArray<double>(newSlotCapacity);
+    int* newProfiles = allocateArray<int>(newSlotCapacity);
+    unsigned char* newFlags = allocateArray<unsigned char>(newSlotCapacity);
+
+    int position = 0;
+    for (int i = 0; i < numVertices; ++i) {
+        int from = rowStart[i];
+        for (int k = 0; k < rowDegree[i]; ++k) {
+            newTargets[position + k] = targets[from + k];
+            newCapacities[position + k] = capacities[from + k];
+            newLatencies[position + k] = baseLatencies[from + k];
+            newMultipliers[position + k] = multipliers[from + k];
+            newProfiles[position + k] = profileIndices[from + k];
+            newFlags[position + k] = flags[from + k];
+        }
+        rowStart[i] = position;
+        rowCapacity[i] = i == growRow ? growCapacity : rowDegree[i];
+        position += rowCapacity[i];
+    }
+
+    freeArray(targets);
+    freeArray(capacities);
+    freeArray(baseLatencies);
+    freeArray(multipliers);
+    freeArray(profileIndices);
+    freeArray(flags);
+    targets = newTargets;
+    capacities = newCapacities;
+    baseLatencies = newLatencies;
+    multipliers = newMultipliers;
+    profileIndices = newProfiles;
+    flags = newFlags;
+
+    usedSlots = position;
+    slotCapacity = newSlotCapacity;
+}
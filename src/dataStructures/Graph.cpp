@@ -1,5 +1,4 @@
 #include "../include/dataStructures/Graph.h"
-#include "../include/domains/Warehouse.h"
 #include <stdexcept>
 
 Graph::Graph(int numWarehouses) : numWarehouses(numWarehouses) {
@@ -8,6 +7,7 @@ Graph::Graph(int numWarehouses) : numWarehouses(numWarehouses) {
     for (int i = 0; i < numWarehouses; ++i) {
         this->adjacencyMatrix[i] = new int[numWarehouses]{0}; //* Inicializa com 0
     }
+    this->adjacencyLists = new NeighborLists(numWarehouses);
 }
 
 Graph::~Graph() {
@@ -15,6 +15,7 @@ Graph::~Graph() {
         delete[] this->adjacencyMatrix[i];
     }
     delete[] this->adjacencyMatrix;
+    delete this->adjacencyLists;
 }
 
 int Graph::getNumWarehouses() const noexcept {
@@ -28,6 +29,15 @@ void Graph::addEdge(int i, int j, int capacity) {
 
     this->adjacencyMatrix[i][j] = capacity;
     this->adjacencyMatrix[j][i] = capacity;
+
+    //* Capacidade não positiva equivale a não ter aresta (mesmo critério de hasEdge)
+    if (capacity > 0) {
+        this->adjacencyLists->insert(i, j);
+        this->adjacencyLists->insert(j, i);
+    } else {
+        this->adjacencyLists->remove(i, j);
+        this->adjacencyLists->remove(j, i);
+    }
 }
 
 bool Graph::hasEdge(int i, int j) const {
@@ -39,19 +49,46 @@ bool Graph::hasEdge(int i, int j) const {
 }
 
 LinkedList Graph::getNeighbors(int warehouseIndex) const {
-    for (int i = 0; i < numWarehouses; ++i) {
-        if (i < 0 || i >= numWarehouses) {
-            throw std::out_of_range("Índice fora do intervalo do grafo");
-        }
+    LinkedList neighborList;
+    for (int neighbor : neighbors(warehouseIndex)) {
+        neighborList.addBack(neighbor);
+    }
+    return neighborList;
+}
+
+NeighborView Graph::neighbors(int warehouseIndex) const {
+    if (warehouseIndex < 0 || warehouseIndex >= numWarehouses) {
+        throw std::out_of_range("Índice fora do intervalo do grafo");
+    }
+
+    return this->adjacencyLists->view(warehouseIndex);
+}
+
+void Graph::setNeighborOrder(const int* rank) {
+    this->adjacencyLists->setOrder(rank);
+}
+
+void Graph::buildBfsTree(int origin, int* parent, int* queue) const {
+    if (origin < 0 || origin >= numWarehouses) {
+        throw std::out_of_range("Índice fora do intervalo do grafo");
     }
 
-    LinkedList neighbors;
+    for (int i = 0; i < numWarehouses; ++i) {
+        parent[i] = -2;
+    }
+    parent[origin] = -1;
 
-    for (int j = 0; j < numWarehouses; ++j) {
-        if (this->adjacencyMatrix[warehouseIndex][j] > 0) {
-            Warehouse neighbor(j, numWarehouses);
-            neighbors.addBack(neighbor.getId());
+    //* Pai na primeira descoberta: mesma árvore de calculateOptimalRoute
+    int head = 0;
+    int tail = 0;
+    queue[tail++] = origin;
+    while (head < tail) {
+        int current = queue[head++];
+        for (int neighbor : neighbors(current)) {
+            if (parent[neighbor] == -2) {
+                parent[neighbor] = current;
+                queue[tail++] = neighbor;
+            }
         }
     }
-    return neighbors;
-}
\ No newline at end of file
+}
@@ -1,39 +1,45 @@
 #include "../../include/dataStructures/GraphExtended.h"
+#include "../../include/dataStructures/KShortestPaths.h"
+#include "../../include/utils/ThreadPool.h"
+#include <algorithm>
 #include <climits>
 #include <cmath>
 
-GraphExtended::GraphExtended(int numWarehouses) : numWarehouses(numWarehouses), currentTime(0), cacheValid(false) {
-    // Inicializa matriz de informações de arestas
-    edgeMatrix = new EdgeInfo*[numWarehouses];
-    for (int i = 0; i < numWarehouses; ++i) {
-        edgeMatrix[i] = new EdgeInfo[numWarehouses];
-    }
-
-    // Inicializa cache de rotas
-    routeCache = new Route**[numWarehouses];
-    for (int i = 0; i < numWarehouses; ++i) {
-        routeCache[i] = new Route*[numWarehouses];
-        for (int j = 0; j < numWarehouses; ++j) {
-            routeCache[i][j] = nullptr;
-        }
+GraphExtended::GraphExtended(int numWarehouses)
+    : numWarehouses(numWarehouses), currentTime(0), numClosedEdges(0), closedEdges(nullptr), closedEdgesCapacity(0), latencyMatrix(nullptr), latencyMatrixValid(false), denseKernel(nullptr), rowLatencies(nullptr), routingEngine(DENSE_DIJKSTRA),
+      contractionHierarchy(nullptr), profiles(nullptr), numProfiles(0), profilesCapacity(0), arrivalTime(nullptr), arrivalParent(nullptr), arrivalHeap(nullptr) {
+    edgeStore = new EdgeStore(numWarehouses);
+    adjacencyLists = new NeighborLists(numWarehouses);
+
+    // Matriz de latências e kernel denso são alocados uma única vez
+    if (numWarehouses > 0) {
+        latencyMatrix = DenseDijkstra::allocateAligned(static_cast<size_t>(numWarehouses) * DenseDijkstra::rowStride(numWarehouses));
+        denseKernel = new DenseDijkstra(numWarehouses);
+        rowLatencies = new int[numWarehouses];
+        arrivalTime = new int[numWarehouses];
+        arrivalParent = new int[numWarehouses];
+        arrivalHeap = new IndexedMinHeap(numWarehouses);
     }
 }
 
 GraphExtended::~GraphExtended() {
-    // Limpa matriz de arestas
-    for (int i = 0; i < numWarehouses; ++i) {
-        delete[] edgeMatrix[i];
+    delete edgeStore;
+    delete adjacencyLists;
+
+    delete[] closedEdges;
+    DenseDijkstra::freeAligned(latencyMatrix);
+    delete denseKernel;
+    delete[] rowLatencies;
+    delete contractionHierarchy;
+
+    for (int i = 0; i < numProfiles; ++i) {
+        delete[] profiles[i].times;
+        delete[] profiles[i].latencies;
     }
-    delete[] edgeMatrix;
-
-    // Limpa cache de rotas
-    for (int i = 0; i < numWarehouses; ++i) {
-        for (int j = 0; j < numWarehouses; ++j) {
-            delete routeCache[i][j];
-        }
-        delete[] routeCache[i];
-    }
-    delete[] routeCache;
+    delete[] profiles;
+    delete[] arrivalTime;
+    delete[] arrivalParent;
+    delete arrivalHeap;
 }
 
 int GraphExtended::getNumWarehouses() const noexcept {
@@ -43,7 +49,7 @@ int GraphExtended::getNumWarehouses() const noexcept {
 void GraphExtended::updateCurrentTime(int time) {
     if (time != currentTime) {
         currentTime = time;
-        invalidateCache(); // Invalida cache quando tempo muda
+        latencyMatrixValid = false;
     }
 }
 
@@ -52,16 +58,49 @@ void GraphExtended::addEdge(int i, int j, int capacity, int baseLatency, double
         return;
     }
 
-    edgeMatrix[i][j] = EdgeInfo(capacity, baseLatency, timeMultiplier);
-    edgeMatrix[j][i] = EdgeInfo(capacity, baseLatency, timeMultiplier);
-    invalidateCache();
+    if (edgeStore->state(edgeStore->insert(i, j)) == EdgeStore::EDGE_CLOSED) {
+        removeClosedEdge(i, j);
+    }
+
+    // Cada sentido tem sua posição (a inserção de j -> i pode mover i -> j, por isso a busca é refeita)
+    edgeStore->insert(j, i);
+    for (int slot : {edgeStore->find(i, j), edgeStore->find(j, i)}) {
+        edgeStore->capacity(slot) = capacity;
+        edgeStore->baseLatency(slot) = baseLatency;
+        edgeStore->multiplier(slot) = timeMultiplier;
+        edgeStore->profileIndex(slot) = -1;
+        edgeStore->state(slot) = EdgeStore::EDGE_ACTIVE;
+    }
+    adjacencyLists->insert(i, j);
+    adjacencyLists->insert(j, i);
+    latencyMatrixValid = false;
+
+    // A hierarquia foi construída para a topologia anterior
+    if (contractionHierarchy != nullptr) {
+        delete contractionHierarchy;
+        contractionHierarchy = nullptr;
+        routingEngine = DENSE_DIJKSTRA;
+    }
+}
+
+void GraphExtended::compactEdges() {
+    edgeStore->compact();
 }
 
 EdgeInfo GraphExtended::getEdgeInfo(int i, int j) const {
     if (i < 0 || i >= numWarehouses || j < 0 || j >= numWarehouses) {
         return EdgeInfo();
     }
-    return edgeMatrix[i][j];
+    int slot = edgeStore->find(i, j);
+    return slot == -1 ? EdgeInfo() : edgeAt(slot);
+}
+
+EdgeInfo GraphExtended::edgeAt(int slot) const {
+    EdgeInfo edge(edgeStore->capacity(slot), edgeStore->baseLatency(slot), edgeStore->multiplier(slot));
+    edge.profileIndex = edgeStore->profileIndex(slot);
+    edge.isActive = edgeStore->state(slot) == EdgeStore::EDGE_ACTIVE;
+    edge.isClosed = edgeStore->state(slot) == EdgeStore::EDGE_CLOSED;
+    return edge;
 }
 
 int GraphExtended::getDynamicLatency(int i, int j) const {
@@ -69,174 +108,542 @@ int GraphExtended::getDynamicLatency(int i, int j) const {
         return INT_MAX;
     }
 
-    EdgeInfo edge = edgeMatrix[i][j];
-    if (!edge.isActive) {
+    return getLatencyAt(i, j, currentTime);
+}
+
+int GraphExtended::getLatencyAt(int i, int j, int time) const {
+    if (i < 0 || i >= numWarehouses || j < 0 || j >= numWarehouses) {
         return INT_MAX;
     }
 
-    // Calcula latência dinâmica baseada no tempo
-    double timeFactor = 1.0 + 0.1 * sin(currentTime * 0.01); // Variação senoidal
-    return static_cast<int>(edge.baseLatency * edge.timeMultiplier * timeFactor);
+    int slot = edgeStore->find(i, j);
+    if (slot == -1 || edgeStore->state(slot) != EdgeStore::EDGE_ACTIVE) {
+        return INT_MAX;
+    }
+
+    return evaluateLatency(edgeAt(slot), profiles, time);
 }
 
-bool GraphExtended::hasEdge(int i, int j) const {
-    if (i < 0 || i >= numWarehouses || j < 0 || j >= numWarehouses) {
-        return false;
+int GraphExtended::evaluateLatency(const EdgeInfo& edge, const LatencyProfile* profiles, int time) {
+    if (edge.profileIndex != -1) {
+        return evaluateProfile(profiles[edge.profileIndex], time);
     }
-    return edgeMatrix[i][j].isActive;
+
+    // Calcula latência dinâmica baseada no tempo
+    double timeFactor = 1.0 + 0.1 * sin(time * 0.01); // Variação senoidal
+    return static_cast<int>(edge.baseLatency * edge.timeMultiplier * timeFactor);
 }
 
-LinkedList GraphExtended::getNeighbors(int warehouseIndex) const {
-    LinkedList neighbors;
+int GraphExtended::weightSurcharge(int baseLatency, double timeMultiplier, double weightFactor) noexcept {
+    return static_cast<int>(baseLatency * timeMultiplier * (weightFactor - 1.0));
+}
 
-    if (warehouseIndex < 0 || warehouseIndex >= numWarehouses) {
-        return neighbors;
+int GraphExtended::evaluateProfile(const LatencyProfile& profile, int time) {
+    // Perfil linear por partes: busca binária do segmento que contém o instante
+    if (time <= profile.times[0]) {
+        return profile.latencies[0];
+    }
+    if (time >= profile.times[profile.numPoints - 1]) {
+        return profile.latencies[profile.numPoints - 1];
     }
 
-    for (int j = 0; j < numWarehouses; ++j) {
-        if (edgeMatrix[warehouseIndex][j].isActive) {
-            neighbors.addBack(j);
+    int low = 0;
+    int high = profile.numPoints - 1;
+    while (high - low > 1) {
+        int mid = (low + high) / 2;
+        if (profile.times[mid] <= time) {
+            low = mid;
+        } else {
+            high = mid;
         }
     }
 
-    return neighbors;
+    double fraction = static_cast<double>(time - profile.times[low]) / (profile.times[high] - profile.times[low]);
+    return static_cast<int>(profile.latencies[low] + fraction * (profile.latencies[high] - profile.latencies[low]));
 }
 
-LinkedList GraphExtended::findAllRoutes(int origin, int destination, int maxDepth) {
-    LinkedList allRoutes;
-    LinkedList currentPath;
-    bool* visited = new bool[numWarehouses];
+void GraphExtended::evaluateRowLatencies(int u, int time, int* out) const {
+    double timeFactor = 1.0 + 0.1 * sin(time * 0.01); // Variação senoidal
+    edgeStore->evaluateRow(u, timeFactor, out);
 
-    for (int i = 0; i < numWarehouses; ++i) {
-        visited[i] = false;
+    // Arestas com perfil são corrigidas depois, fora do laço vetorizado
+    if (numProfiles > 0) {
+        int begin = edgeStore->rowBegin(u);
+        for (int slot = begin; slot < edgeStore->rowEnd(u); ++slot) {
+            if (edgeStore->profileIndex(slot) != -1) {
+                out[slot - begin] = evaluateProfile(profiles[edgeStore->profileIndex(slot)], time);
+            }
+        }
     }
+}
 
-    currentPath.addBack(origin);
-    visited[origin] = true;
-
-    dfsRoutes(origin, destination, currentPath, allRoutes, visited, 0, maxDepth);
+const LatencyProfile* GraphExtended::getLatencyProfiles() const noexcept {
+    return profiles;
+}
 
-    delete[] visited;
-    return allRoutes;
+int GraphExtended::getNumLatencyProfiles() const noexcept {
+    return numProfiles;
 }
 
-Route GraphExtended::findBestRoute(int origin, int destination, int packageWeight, int currentTime) {
-    // Verifica cache primeiro
-    if (cacheValid && routeCache[origin][destination] != nullptr) {
-        return *routeCache[origin][destination];
+bool GraphExtended::setLatencyProfile(int i, int j, const int* times, const int* latencies, int numPoints) {
+    if (!hasEdge(i, j) || numPoints <= 0) {
+        return false;
     }
 
-    Route bestRoute;
+    // FIFO: t + L(t) não decresce, ou seja, cada segmento tem inclinação >= -1
+    for (int k = 0; k < numPoints; ++k) {
+        if (latencies[k] < 0) {
+            return false;
+        }
+        if (k > 0 && (times[k] <= times[k - 1] || times[k] + latencies[k] < times[k - 1] + latencies[k - 1])) {
+            return false;
+        }
+    }
 
-    // Implementação de Dijkstra modificado considerando peso e tempo
-    int* dist = new int[numWarehouses];
-    int* parent = new int[numWarehouses];
-    bool* visited = new bool[numWarehouses];
+    if (numProfiles == profilesCapacity) {
+        int newCapacity = profilesCapacity == 0 ? 4 : profilesCapacity * 2;
+        LatencyProfile* newProfiles = new LatencyProfile[newCapacity];
+        for (int k = 0; k < numProfiles; ++k) {
+            newProfiles[k] = profiles[k];
+        }
+        delete[] profiles;
+        profiles = newProfiles;
+        profilesCapacity = newCapacity;
+    }
 
-    for (int i = 0; i < numWarehouses; ++i) {
-        dist[i] = INT_MAX;
-        parent[i] = -1;
-        visited[i] = false;
+    LatencyProfile& profile = profiles[numProfiles];
+    profile.times = new int[numPoints];
+    profile.latencies = new int[numPoints];
+    profile.numPoints = numPoints;
+    for (int k = 0; k < numPoints; ++k) {
+        profile.times[k] = times[k];
+        profile.latencies[k] = latencies[k];
     }
 
-    dist[origin] = 0;
+    edgeStore->profileIndex(edgeStore->find(i, j)) = numProfiles;
+    edgeStore->profileIndex(edgeStore->find(j, i)) = numProfiles;
+    numProfiles++;
+
+    latencyMatrixValid = false;
+    if (contractionHierarchy != nullptr) {
+        delete contractionHierarchy;
+        contractionHierarchy = nullptr;
+        routingEngine = DENSE_DIJKSTRA;
+    }
+    return true;
+}
 
-    for (int count = 0; count < numWarehouses - 1; ++count) {
-        int u = -1;
-        for (int v = 0; v < numWarehouses; ++v) {
-            if (!visited[v] && (u == -1 || dist[v] < dist[u])) {
-                u = v;
+bool GraphExtended::isFifo() const {
+    // Perfis são validados na inserção; a variação senoidal tem derivada máxima base * multiplicador * 0.001
+    for (int i = 0; i < numWarehouses; ++i) {
+        for (int slot = edgeStore->rowBegin(i); slot < edgeStore->rowEnd(i); ++slot) {
+            if (edgeStore->target(slot) > i && edgeStore->state(slot) == EdgeStore::EDGE_ACTIVE && edgeStore->profileIndex(slot) == -1 &&
+                edgeStore->baseLatency(slot) * edgeStore->multiplier(slot) * 0.001 > 1.0) {
+                return false;
             }
         }
+    }
+    return true;
+}
 
-        if (u == -1 || dist[u] == INT_MAX)
-            break;
+bool GraphExtended::hasEdge(int i, int j) const {
+    if (i < 0 || i >= numWarehouses || j < 0 || j >= numWarehouses) {
+        return false;
+    }
+    int slot = edgeStore->find(i, j);
+    return slot != -1 && edgeStore->state(slot) == EdgeStore::EDGE_ACTIVE;
+}
+
+LinkedList GraphExtended::getNeighbors(int warehouseIndex) const {
+    LinkedList neighborList;
+    for (int neighbor : neighbors(warehouseIndex)) {
+        neighborList.addBack(neighbor);
+    }
+    return neighborList;
+}
 
-        visited[u] = true;
+NeighborView GraphExtended::neighbors(int warehouseIndex) const {
+    if (warehouseIndex < 0 || warehouseIndex >= numWarehouses) {
+        return NeighborView();
+    }
+    return adjacencyLists->view(warehouseIndex);
+}
 
-        for (int v = 0; v < numWarehouses; ++v) {
-            if (!visited[v] && hasEdge(u, v)) {
-                // Calcula custo considerando peso do pacote
-                int baseCost = getDynamicLatency(u, v);
-                double weightFactor = 1.0 + (packageWeight - 1) * 0.1;
-                int totalCost = static_cast<int>(baseCost * weightFactor);
+int GraphExtended::findAllRoutes(int origin, int destination, Route* routes, int maxRoutes, int packageWeight) {
+    // Yen: cada rota só é calculada quando a anterior já foi entregue
+    KShortestPaths generator(*this, origin, destination, packageWeight);
 
-                if (dist[u] + totalCost < dist[v]) {
-                    dist[v] = dist[u] + totalCost;
-                    parent[v] = u;
+    int found = 0;
+    while (found < maxRoutes && generator.nextRoute(routes[found])) {
+        routes[found].priority = calculateRoutePriority(routes[found].path, packageWeight, currentTime);
+        found++;
+    }
+    return found;
+}
+
+Route GraphExtended::findBestRoute(int origin, int destination, int packageWeight, int currentTime) {
+    Route bestRoute;
+
+    if (origin < 0 || origin >= numWarehouses || destination < 0 || destination >= numWarehouses) {
+        return bestRoute;
+    }
+
+    // Dijkstra dependente do tempo, partindo no instante da consulta
+    if (routingEngine == TIME_DEPENDENT) {
+        return findEarliestArrivalRoute(origin, destination, currentTime, packageWeight);
+    }
+
+    double weightFactor = 1.0 + (packageWeight - 1) * 0.1;
+
+    // Hierarquia de contração: caminho pelas latências base, custo pelas latências dinâmicas
+    if (routingEngine == CONTRACTION_HIERARCHY) {
+        if (contractionHierarchy->query(origin, destination) != INT_MAX) {
+            const int* nodes = contractionHierarchy->getPath();
+            int length = contractionHierarchy->getPathLength();
+
+            RoutePath path;
+            int totalLatency = 0;
+            for (int k = 0; k < length; ++k) {
+                path.addBack(nodes[k]);
+                if (k > 0) {
+                    totalLatency += static_cast<int>(getDynamicLatency(nodes[k - 1], nodes[k]) * weightFactor);
                 }
             }
+
+            bestRoute.path = path;
+            bestRoute.totalLatency = totalLatency;
+            bestRoute.priority = calculateRoutePriority(path, packageWeight, currentTime);
         }
+        return bestRoute;
     }
 
+    // Dijkstra denso vetorizado sobre a matriz de latências, considerando peso e tempo
+    if (!latencyMatrixValid) {
+        rebuildLatencyMatrix();
+    }
+    denseKernel->run(latencyMatrix, origin, weightFactor);
+
     // Reconstroi rota
-    if (dist[destination] != INT_MAX) {
-        LinkedList path;
+    if (denseKernel->getDistance(destination) != INT_MAX) {
+        RoutePath path;
         int current = destination;
         while (current != -1) {
             path.addFront(current);
-            current = parent[current];
+            current = denseKernel->getParent(current);
         }
 
         bestRoute.path = path;
-        bestRoute.totalLatency = dist[destination];
+        bestRoute.totalLatency = denseKernel->getDistance(destination);
         bestRoute.priority = calculateRoutePriority(path, packageWeight, currentTime);
+    }
+
+    return bestRoute;
+}
+
+void GraphExtended::findBestRoutes(const int* origins, const int* destinations, const int* weights, int count, Route* routes, int currentTime, ThreadPool& pool) {
+    if (count <= 0 || numWarehouses <= 0) {
+        return;
+    }
+
+    // A hierarquia usa buffers únicos e já responde cada par sem árvore completa
+    if (routingEngine == CONTRACTION_HIERARCHY) {
+        for (int i = 0; i < count; ++i) {
+            routes[i] = findBestRoute(origins[i], destinations[i], weights[i], currentTime);
+        }
+        return;
+    }
 
-        // Salva no cache
-        if (routeCache[origin][destination] != nullptr) {
-            delete routeCache[origin][destination];
+    // Agrupa os pares por (origem, peso)
+    int* order = new int[count];
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::sort(order, order + count, [origins, weights](int a, int b) {
+        if (origins[a] != origins[b]) {
+            return origins[a] < origins[b];
         }
-        routeCache[origin][destination] = new Route(bestRoute);
+        if (weights[a] != weights[b]) {
+            return weights[a] < weights[b];
+        }
+        return a < b;
+    });
+
+    int* groupStart = new int[count + 1];
+    int numGroups = 0;
+    for (int k = 0; k < count; ++k) {
+        if (k == 0 || origins[order[k]] != origins[order[k - 1]] || weights[order[k]] != weights[order[k - 1]]) {
+            groupStart[numGroups++] = k;
+        }
+    }
+    groupStart[numGroups] = count;
+
+    // A matriz de latências é compartilhada (somente leitura) pelas threads
+    bool timeDependent = routingEngine == TIME_DEPENDENT;
+    if (!timeDependent && !latencyMatrixValid) {
+        rebuildLatencyMatrix();
+    }
+
+    int numWorkers = pool.getNumThreads();
+    DenseDijkstra** kernels = new DenseDijkstra*[numWorkers];
+    int** arrival = new int*[numWorkers];
+    int** parent = new int*[numWorkers];
+    IndexedMinHeap** heaps = new IndexedMinHeap*[numWorkers];
+    int** rowLatency = new int*[numWorkers];
+    for (int t = 0; t < numWorkers; ++t) {
+        kernels[t] = timeDependent ? nullptr : new DenseDijkstra(numWarehouses);
+        arrival[t] = timeDependent ? new int[numWarehouses] : nullptr;
+        parent[t] = timeDependent ? new int[numWarehouses] : nullptr;
+        heaps[t] = timeDependent ? new IndexedMinHeap(numWarehouses) : nullptr;
+        rowLatency[t] = timeDependent ? new int[numWarehouses] : nullptr;
     }
 
-    delete[] dist;
+    pool.parallelFor(0, numGroups, [&](int group, int worker) {
+        int first = order[groupStart[group]];
+        int origin = origins[first];
+        int weight = weights[first];
+        if (origin < 0 || origin >= numWarehouses) {
+            return;
+        }
+
+        double weightFactor = 1.0 + (weight - 1) * 0.1;
+        if (timeDependent) {
+            runEarliestArrival(origin, currentTime, weightFactor, -1, arrival[worker], parent[worker], *heaps[worker], rowLatency[worker]);
+        } else {
+            kernels[worker]->run(latencyMatrix, origin, weightFactor);
+        }
+
+        for (int k = groupStart[group]; k < groupStart[group + 1]; ++k) {
+            int i = order[k];
+            int destination = destinations[i];
+            if (destination < 0 || destination >= numWarehouses) {
+                continue;
+            }
+
+            int latency = INT_MAX;
+            if (timeDependent) {
+                latency = arrival[worker][destination] == INT_MAX ? INT_MAX : arrival[worker][destination] - currentTime;
+            } else {
+                latency = kernels[worker]->getDistance(destination);
+            }
+            if (latency == INT_MAX) {
+                continue;
+            }
+
+            RoutePath path;
+            for (int current = destination; current != -1; current = timeDependent ? parent[worker][current] : kernels[worker]->getParent(current)) {
+                path.addFront(current);
+            }
+
+            routes[i].path = path;
+            routes[i].totalLatency = latency;
+            routes[i].priority = calculateRoutePriority(path, weight, currentTime);
+        }
+    });
+
+    for (int t = 0; t < numWorkers; ++t) {
+        delete kernels[t];
+        delete[] arrival[t];
+        delete[] parent[t];
+        delete heaps[t];
+        delete[] rowLatency[t];
+    }
+    delete[] kernels;
+    delete[] arrival;
     delete[] parent;
-    delete[] visited;
+    delete[] heaps;
+    delete[] rowLatency;
+    delete[] order;
+    delete[] groupStart;
+}
+
+Route GraphExtended::findEarliestArrivalRoute(int origin, int destination, int departureTime, int packageWeight) {
+    Route bestRoute;
+
+    if (origin < 0 || origin >= numWarehouses || destination < 0 || destination >= numWarehouses) {
+        return bestRoute;
+    }
+
+    double weightFactor = 1.0 + (packageWeight - 1) * 0.1;
+    runEarliestArrival(origin, departureTime, weightFactor, destination, arrivalTime, arrivalParent, *arrivalHeap, rowLatencies);
+
+    if (arrivalTime[destination] != INT_MAX) {
+        RoutePath path;
+        for (int current = destination; current != -1; current = arrivalParent[current]) {
+            path.addFront(current);
+        }
+
+        bestRoute.path = path;
+        bestRoute.totalLatency = arrivalTime[destination] - departureTime;
+        bestRoute.priority = calculateRoutePriority(path, packageWeight, departureTime);
+    }
 
     return bestRoute;
 }
 
-void GraphExtended::invalidateCache() {
-    for (int i = 0; i < numWarehouses; ++i) {
-        for (int j = 0; j < numWarehouses; ++j) {
-            if (routeCache[i][j] != nullptr) {
-                delete routeCache[i][j];
-                routeCache[i][j] = nullptr;
+void GraphExtended::runEarliestArrival(int origin, int departureTime, double weightFactor, int target, int* arrival, int* parent, IndexedMinHeap& heap, int* rowLatency) const {
+    for (int v = 0; v < numWarehouses; ++v) {
+        arrival[v] = INT_MAX;
+        parent[v] = -1;
+    }
+    heap.clear();
+
+    arrival[origin] = departureTime;
+    heap.pushOrDecrease(origin, departureTime);
+
+    //* Com FIFO o primeiro instante de chegada fixado em cada armazém é o mínimo, como no Dijkstra estático
+    while (!heap.isEmpty()) {
+        int u = heap.extractMin();
+        if (u == target) {
+            break;
+        }
+
+        // Todas as arestas de u são avaliadas no mesmo instante de uma vez; as fechadas são puladas
+        evaluateRowLatencies(u, arrival[u], rowLatency);
+        int begin = edgeStore->rowBegin(u);
+        for (int slot = begin; slot < edgeStore->rowEnd(u); ++slot) {
+            int v = edgeStore->target(slot);
+            if (v == u || edgeStore->state(slot) != EdgeStore::EDGE_ACTIVE) {
+                continue;
+            }
+            int cost = rowLatency[slot - begin] + weightSurcharge(edgeStore->baseLatency(slot), edgeStore->multiplier(slot), weightFactor);
+            int candidate = arrival[u] + cost;
+            if (candidate < arrival[v]) {
+                arrival[v] = candidate;
+                parent[v] = u;
+                heap.pushOrDecrease(v, candidate);
             }
         }
     }
-    cacheValid = false;
 }
 
-void GraphExtended::dfsRoutes(int current, int destination, LinkedList& currentPath, LinkedList& allRoutes, bool* visited, int depth, int maxDepth) {
-    if (depth > maxDepth)
-        return;
+bool GraphExtended::setEdgeActive(int i, int j, bool active) {
+    if (i < 0 || i >= numWarehouses || j < 0 || j >= numWarehouses) {
+        return false;
+    }
+    int slot = edgeStore->find(i, j);
+    if (slot == -1 || edgeStore->state(slot) != (active ? EdgeStore::EDGE_CLOSED : EdgeStore::EDGE_ACTIVE)) {
+        return false;
+    }
 
-    if (current == destination) {
-        // Adiciona rota encontrada à lista
-        // (Implementação simplificada - na prática, seria necessário copiar o caminho)
-        return;
+    unsigned char state = active ? EdgeStore::EDGE_ACTIVE : EdgeStore::EDGE_CLOSED;
+    edgeStore->state(slot) = state;
+    edgeStore->state(edgeStore->find(j, i)) = state;
+    if (active) {
+        adjacencyLists->insert(i, j);
+        adjacencyLists->insert(j, i);
+        removeClosedEdge(i, j);
+    } else {
+        adjacencyLists->remove(i, j);
+        adjacencyLists->remove(j, i);
+        addClosedEdge(i, j);
+    }
+
+    applyEdgeChange(i, j);
+    return true;
+}
+
+bool GraphExtended::setEdgeLatency(int i, int j, int baseLatency) {
+    if (i < 0 || i >= numWarehouses || j < 0 || j >= numWarehouses) {
+        return false;
+    }
+    int slot = edgeStore->find(i, j);
+    if (slot == -1 || edgeStore->state(slot) == 0) {
+        return false;
+    }
+
+    edgeStore->baseLatency(slot) = baseLatency;
+    edgeStore->baseLatency(edgeStore->find(j, i)) = baseLatency;
+
+    //* Aresta fechada guarda a nova latência para a reabertura; nenhuma rota passa por ela
+    if (edgeStore->state(slot) == EdgeStore::EDGE_ACTIVE) {
+        applyEdgeChange(i, j);
     }
+    return true;
+}
+
+int GraphExtended::getNumClosedEdges() const noexcept {
+    return numClosedEdges;
+}
 
-    for (int neighbor = 0; neighbor < numWarehouses; ++neighbor) {
-        if (!visited[neighbor] && hasEdge(current, neighbor)) {
-            visited[neighbor] = true;
-            currentPath.addBack(neighbor);
+const int* GraphExtended::getClosedEdges() const noexcept {
+    return closedEdges;
+}
 
-            dfsRoutes(neighbor, destination, currentPath, allRoutes, visited, depth + 1, maxDepth);
+void GraphExtended::addClosedEdge(int i, int j) {
+    if (numClosedEdges == closedEdgesCapacity) {
+        int newCapacity = closedEdgesCapacity == 0 ? 4 : closedEdgesCapacity * 2;
+        int* newEdges = new int[2 * newCapacity];
+        for (int k = 0; k < 2 * numClosedEdges; ++k) {
+            newEdges[k] = closedEdges[k];
+        }
+        delete[] closedEdges;
+        closedEdges = newEdges;
+        closedEdgesCapacity = newCapacity;
+    }
+    closedEdges[2 * numClosedEdges] = std::min(i, j);
+    closedEdges[2 * numClosedEdges + 1] = std::max(i, j);
+    numClosedEdges++;
+}
 
-            currentPath.removeBack();
-            visited[neighbor] = false;
+void GraphExtended::removeClosedEdge(int i, int j) {
+    int low = std::min(i, j);
+    int high = std::max(i, j);
+    for (int k = 0; k < numClosedEdges; ++k) {
+        if (closedEdges[2 * k] == low && closedEdges[2 * k + 1] == high) {
+            //* A ordem da lista não importa: a última aresta ocupa a posição liberada
+            numClosedEdges--;
+            closedEdges[2 * k] = closedEdges[2 * numClosedEdges];
+            closedEdges[2 * k + 1] = closedEdges[2 * numClosedEdges + 1];
+            return;
         }
     }
 }
 
-double GraphExtended::calculateRoutePriority(const LinkedList& path, int packageWeight, int currentTime) {
+void GraphExtended::applyEdgeChange(int i, int j) {
+    // Só as duas posições da aresta mudam na matriz de latências
+    if (latencyMatrixValid) {
+        int stride = DenseDijkstra::rowStride(numWarehouses);
+        latencyMatrix[static_cast<size_t>(i) * stride + j] = hasEdge(i, j) ? getDynamicLatency(i, j) : DenseDijkstra::NO_EDGE;
+        latencyMatrix[static_cast<size_t>(j) * stride + i] = hasEdge(j, i) ? getDynamicLatency(j, i) : DenseDijkstra::NO_EDGE;
+    }
+
+    // A hierarquia foi construída com as latências anteriores
+    if (contractionHierarchy != nullptr) {
+        delete contractionHierarchy;
+        contractionHierarchy = nullptr;
+        routingEngine = DENSE_DIJKSTRA;
+    }
+}
+
+void GraphExtended::attachContractionHierarchy(ContractionHierarchy* hierarchy) {
+    if (hierarchy == contractionHierarchy) {
+        return;
+    }
+    delete contractionHierarchy;
+    contractionHierarchy = hierarchy;
+    routingEngine = hierarchy != nullptr ? CONTRACTION_HIERARCHY : DENSE_DIJKSTRA;
+}
+
+void GraphExtended::setRoutingEngine(RoutingEngine engine) {
+    if (engine == CONTRACTION_HIERARCHY && contractionHierarchy == nullptr) {
+        return;
+    }
+    routingEngine = engine;
+}
+
+RoutingEngine GraphExtended::getRoutingEngine() const noexcept {
+    return routingEngine;
+}
+
+double GraphExtended::calculateRoutePriority(const RoutePath& path, int packageWeight, int currentTime) const {
+    return routePriority(path.getCurrentSize(), packageWeight, currentTime);
+}
+
+double GraphExtended::routePriority(int pathLength, int packageWeight, int currentTime) {
     // Calcula prioridade baseada em múltiplos fatores
     double priority = 0.0;
 
     // Fator de distância (menor distância = maior prioridade)
-    int pathLength = path.getCurrentSize();
     priority += 100.0 / (pathLength + 1);
 
     // Fator de peso (pacotes mais pesados têm prioridade em rotas mais curtas)
@@ -247,4 +654,26 @@ double GraphExtended::calculateRoutePriority(const LinkedList& path, int package
     priority *= timeFactor;
 
     return priority;
+}
+
+void GraphExtended::rebuildLatencyMatrix() {
+    int stride = DenseDijkstra::rowStride(numWarehouses);
+
+    for (int i = 0; i < numWarehouses; ++i) {
+        // Colunas sem aresta (e as de alinhamento) nunca são relaxadas
+        int* row = latencyMatrix + static_cast<size_t>(i) * stride;
+        for (int j = 0; j < stride; ++j) {
+            row[j] = DenseDijkstra::NO_EDGE;
+        }
+
+        evaluateRowLatencies(i, currentTime, rowLatencies);
+        int begin = edgeStore->rowBegin(i);
+        for (int slot = begin; slot < edgeStore->rowEnd(i); ++slot) {
+            if (edgeStore->state(slot) == EdgeStore::EDGE_ACTIVE) {
+                row[edgeStore->target(slot)] = rowLatencies[slot - begin];
+            }
+        }
+    }
+
+    latencyMatrixValid = true;
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "../../include/dataStructures/IndexedMinHeap.h"
+#include <stdexcept>
+
+IndexedMinHeap::IndexedMinHeap(int capacity) : capacity(capacity), currentSize(0) {
+    if (capacity <= 0) {
+        throw std::invalid_argument("A capacidade do IndexedMinHeap deve ser um número positivo.");
+    }
+    heapArray = new int[capacity];
+    keys = new int[capacity];
+    position = new int[capacity];
+    for (int i = 0; i < capacity; ++i) {
+        position[i] = -1;
+    }
+}
+
+IndexedMinHeap::~IndexedMinHeap() {
+    delete[] heapArray;
+    delete[] keys;
+    delete[] position;
+}
+
+bool IndexedMinHeap::isEmpty() const noexcept {
+    return currentSize == 0;
+}
+
+int IndexedMinHeap::getCurrentSize() const noexcept {
+    return currentSize;
+}
+
+bool IndexedMinHeap::contains(int vertex) const noexcept {
+    return vertex >= 0 && vertex < capacity && position[vertex] != -1;
+}
+
+void IndexedMinHeap::pushOrDecrease(int vertex, int key) {
+    if (vertex < 0 || vertex >= capacity) {
+        throw std::out_of_range("Vértice fora do intervalo do IndexedMinHeap.");
+    }
+
+    if (position[vertex] == -1) {
+        keys[vertex] = key;
+        heapArray[currentSize] = vertex;
+        position[vertex] = currentSize;
+        currentSize++;
+        heapifyUp(currentSize - 1);
+    } else if (key < keys[vertex]) {
+        keys[vertex] = key;
+        heapifyUp(position[vertex]);
+    }
+}
+
+int IndexedMinHeap::peekMin() const {
+    if (isEmpty()) {
+        throw std::out_of_range("O IndexedMinHeap está vazio.");
+    }
+    return heapArray[0];
+}
+
+int IndexedMinHeap::peekMinKey() const {
+    if (isEmpty()) {
+        throw std::out_of_range("O IndexedMinHeap está vazio.");
+    }
+    return keys[heapArray[0]];
+}
+
+int IndexedMinHeap::extractMin() {
+    if (isEmpty()) {
+        throw std::out_of_range("O IndexedMinHeap está vazio.");
+    }
+
+    int minVertex = heapArray[0];
+    currentSize--;
+    if (currentSize > 0) {
+        heapArray[0] = heapArray[currentSize];
+        position[heapArray[0]] = 0;
+        heapifyDown(0);
+    }
+    position[minVertex] = -1;
+
+    return minVertex;
+}
+
+void IndexedMinHeap::clear() noexcept {
+    for (int i = 0; i < currentSize; ++i) {
+        position[heapArray[i]] = -1;
+    }
+    currentSize = 0;
+}
+
+bool IndexedMinHeap::less(int a, int b) const noexcept {
+    if (keys[a] != keys[b]) {
+        return keys[a] < keys[b];
+    }
+    return a < b;
+}
+
+void IndexedMinHeap::heapifyUp(int index) {
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!less(heapArray[index], heapArray[parent])) {
+            break;
+        }
+        swap(index, parent);
+        index = parent;
+    }
+}
+
+void IndexedMinHeap::heapifyDown(int index) {
+    while (true) {
+        int smallest = index;
+        int left = 2 * index + 1;
+        int right = 2 * index + 2;
+
+        if (left < currentSize && less(heapArray[left], heapArray[smallest])) {
+            smallest = left;
+        }
+        if (right < currentSize && less(heapArray[right], heapArray[smallest])) {
+            smallest = right;
+        }
+        if (smallest == index) {
+            break;
+        }
+        swap(index, smallest);
+        index = smallest;
+    }
+}
+
+void IndexedMinHeap::swap(int i, int j) {
+    int temp = heapArray[i];
+    heapArray[i] = heapArray[j];
+    heapArray[j] = temp;
+    position[heapArray[i]] = i;
+    position[heapArray[j]] = j;
+}
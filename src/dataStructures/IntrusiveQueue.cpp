@@ -0,0 +1,24 @@
+#include "../../include/dataStructures/IntrusiveQueue.h"
+#include <stdexcept>
+
+Package IntrusiveQueue::dequeue() {
+    if (isEmpty()) {
+        throw std::out_of_range("A Fila está vazia. Não é possível remover.");
+    }
+
+    int index = front;
+    front = link(index);
+    if (front == -1) {
+        rear = -1;
+    }
+    link(index) = -1;
+    currentSize--;
+    return Package(*table, index);
+}
+
+Package IntrusiveQueue::peek() const {
+    if (isEmpty()) {
+        throw std::out_of_range("A Fila está vazia.");
+    }
+    return Package(*table, front);
+}
@@ -0,0 +1,39 @@
+#include "../../include/dataStructures/IntrusiveStack.h"
+#include <stdexcept>
+
+Package IntrusiveStack::pop() {
+    if (isEmpty()) {
+        throw std::out_of_range("Pilha vazia: Não é possível executar pop.");
+    }
+
+    int index = top;
+    top = link(index);
+    if (top == -1) {
+        bottom = -1;
+    }
+    link(index) = -1;
+    currentSize--;
+    return Package(*table, index);
+}
+
+Package IntrusiveStack::peek() const {
+    if (isEmpty()) {
+        throw std::out_of_range("Pilha vazia: Não é possível executar peek.");
+    }
+    return Package(*table, top);
+}
+
+void IntrusiveStack::popTop(int count, Package* out) {
+    if (count < 0 || count > currentSize) {
+        throw std::out_of_range("Pilha sem pacotes suficientes: Não é possível executar popTop.");
+    }
+    for (int i = 0; i < count; ++i) {
+        out[i] = pop();
+    }
+}
+
+void IntrusiveStack::pushRange(const Package* packages, int count) noexcept {
+    for (int i = count - 1; i >= 0; --i) {
+        push(packages[i]);
+    }
+}
@@ -0,0 +1,318 @@
+#include "../../include/dataStructures/KShortestPaths.h"
+#include <climits>
+
+KShortestPaths::KShortestPaths(const GraphExtended& graph, int origin, int destination, int packageWeight)
+    : numVertices(graph.getNumWarehouses()), origin(origin), destination(destination), offsets(nullptr), targets(nullptr), costs(nullptr), distToDestination(nullptr), nextHop(nullptr),
+      accepted(nullptr), numAccepted(0), acceptedCapacity(0), candidates(nullptr), numCandidates(0), candidatesCapacity(0), gScore(nullptr), parent(nullptr), touched(nullptr), numTouched(0),
+      openSet(nullptr), blockedVertex(nullptr), blockedNext(nullptr), pathBuffer(nullptr), exhausted(false) {
+
+    if (numVertices <= 0 || origin < 0 || origin >= numVertices || destination < 0 || destination >= numVertices) {
+        exhausted = true;
+        return;
+    }
+
+    // Copia os custos para CSR, com o mesmo fator de peso de findBestRoute
+    double weightFactor = 1.0 + (packageWeight - 1) * 0.1;
+    offsets = new int[numVertices + 1];
+    offsets[0] = 0;
+    for (int u = 0; u < numVertices; ++u) {
+        int degree = 0;
+        for (int v : graph.neighbors(u)) {
+            if (v != u) {
+                degree++;
+            }
+        }
+        offsets[u + 1] = offsets[u] + degree;
+    }
+    targets = new int[offsets[numVertices]];
+    costs = new int[offsets[numVertices]];
+    for (int u = 0; u < numVertices; ++u) {
+        int e = offsets[u];
+        for (int v : graph.neighbors(u)) {
+            if (v != u) {
+                targets[e] = v;
+                costs[e] = static_cast<int>(graph.getDynamicLatency(u, v) * weightFactor);
+                e++;
+            }
+        }
+    }
+
+    distToDestination = new int[numVertices];
+    nextHop = new int[numVertices];
+    gScore = new int[numVertices];
+    parent = new int[numVertices];
+    touched = new int[numVertices];
+    blockedVertex = new char[numVertices];
+    blockedNext = new char[numVertices];
+    pathBuffer = new int[numVertices];
+    for (int v = 0; v < numVertices; ++v) {
+        distToDestination[v] = INT_MAX;
+        nextHop[v] = -1;
+        gScore[v] = INT_MAX;
+        parent[v] = -1;
+        blockedVertex[v] = 0;
+        blockedNext[v] = 0;
+    }
+    openSet = new IndexedMinHeap(numVertices);
+
+    // Árvore reversa a partir do destino (as arestas do grafo estendido são simétricas)
+    distToDestination[destination] = 0;
+    openSet->pushOrDecrease(destination, 0);
+    while (!openSet->isEmpty()) {
+        int u = openSet->extractMin();
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            int v = targets[e];
+            int candidate = distToDestination[u] + costs[e];
+            if (candidate < distToDestination[v]) {
+                distToDestination[v] = candidate;
+                nextHop[v] = u;
+                openSet->pushOrDecrease(v, candidate);
+            }
+        }
+    }
+}
+
+KShortestPaths::~KShortestPaths() {
+    for (int i = 0; i < numAccepted; ++i) {
+        delete[] accepted[i].nodes;
+    }
+    for (int i = 0; i < numCandidates; ++i) {
+        delete[] candidates[i].nodes;
+    }
+    delete[] accepted;
+    delete[] candidates;
+    delete[] offsets;
+    delete[] targets;
+    delete[] costs;
+    delete[] distToDestination;
+    delete[] nextHop;
+    delete[] gScore;
+    delete[] parent;
+    delete[] touched;
+    delete[] blockedVertex;
+    delete[] blockedNext;
+    delete[] pathBuffer;
+    delete openSet;
+}
+
+bool KShortestPaths::nextRoute(Route& route) {
+    if (exhausted) {
+        return false;
+    }
+
+    if (numAccepted == 0) {
+        // A primeira rota é o caminho da própria árvore reversa
+        if (distToDestination[origin] == INT_MAX) {
+            exhausted = true;
+            return false;
+        }
+        int length = 0;
+        for (int v = origin; v != -1; v = nextHop[v]) {
+            pathBuffer[length++] = v;
+        }
+        appendPath(accepted, numAccepted, acceptedCapacity, pathBuffer, length, distToDestination[origin]);
+    } else {
+        generateSpurCandidates();
+        if (numCandidates == 0) {
+            exhausted = true;
+            return false;
+        }
+
+        // Menor custo; empate pelo menor número de saltos e depois pela ordem de geração
+        int best = 0;
+        for (int i = 1; i < numCandidates; ++i) {
+            if (candidates[i].cost < candidates[best].cost || (candidates[i].cost == candidates[best].cost && candidates[i].length < candidates[best].length)) {
+                best = i;
+            }
+        }
+
+        if (numAccepted == acceptedCapacity) {
+            appendPath(accepted, numAccepted, acceptedCapacity, candidates[best].nodes, candidates[best].length, candidates[best].cost);
+            delete[] candidates[best].nodes;
+        } else {
+            accepted[numAccepted++] = candidates[best];
+        }
+        for (int i = best + 1; i < numCandidates; ++i) {
+            candidates[i - 1] = candidates[i];
+        }
+        numCandidates--;
+    }
+
+    const StoredPath& path = accepted[numAccepted - 1];
+    route.path = RoutePath(path.nodes, path.length);
+    route.totalLatency = path.cost;
+    return true;
+}
+
+int KShortestPaths::getNumRoutesFound() const noexcept {
+    return numAccepted;
+}
+
+int KShortestPaths::edgeCost(int u, int v) const noexcept {
+    for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+        if (targets[e] == v) {
+            return costs[e];
+        }
+    }
+    return INT_MAX;
+}
+
+void KShortestPaths::generateSpurCandidates() {
+    const StoredPath last = accepted[numAccepted - 1];
+    int rootCost = 0;
+
+    for (int i = 0; i + 1 < last.length; ++i) {
+        int spur = last.nodes[i];
+
+        // Raiz: vértices anteriores ao desvio ficam bloqueados
+        for (int j = 0; j < i; ++j) {
+            blockedVertex[last.nodes[j]] = 1;
+            pathBuffer[j] = last.nodes[j];
+        }
+
+        // Bloqueia a aresta seguinte de toda rota aceita que compartilha a mesma raiz
+        for (int p = 0; p < numAccepted; ++p) {
+            const StoredPath& other = accepted[p];
+            if (other.length <= i + 1) {
+                continue;
+            }
+            bool sameRoot = true;
+            for (int j = 0; j <= i && sameRoot; ++j) {
+                sameRoot = other.nodes[j] == last.nodes[j];
+            }
+            if (sameRoot) {
+                blockedNext[other.nodes[i + 1]] = 1;
+            }
+        }
+
+        int spurLength = 0;
+        int spurCost = findSpurPath(spur, i, spurLength);
+        if (spurCost != INT_MAX) {
+            int length = i + spurLength;
+            if (!isKnownPath(pathBuffer, length)) {
+                appendPath(candidates, numCandidates, candidatesCapacity, pathBuffer, length, rootCost + spurCost);
+            }
+        }
+
+        for (int j = 0; j < i; ++j) {
+            blockedVertex[last.nodes[j]] = 0;
+        }
+        for (int p = 0; p < numAccepted; ++p) {
+            if (accepted[p].length > i + 1) {
+                blockedNext[accepted[p].nodes[i + 1]] = 0;
+            }
+        }
+
+        rootCost += edgeCost(spur, last.nodes[i + 1]);
+    }
+}
+
+int KShortestPaths::findSpurPath(int spur, int offset, int& spurLength) {
+    spurLength = 0;
+    if (distToDestination[spur] == INT_MAX) {
+        return INT_MAX;
+    }
+
+    // Reaproveita a árvore: se o caminho dela não cruza bloqueios, ele continua mínimo
+    bool treePathClear = nextHop[spur] == -1 || !blockedNext[nextHop[spur]];
+    for (int v = nextHop[spur]; treePathClear && v != -1; v = nextHop[v]) {
+        treePathClear = !blockedVertex[v];
+    }
+    if (treePathClear) {
+        for (int v = spur; v != -1; v = nextHop[v]) {
+            pathBuffer[offset + spurLength++] = v;
+        }
+        return distToDestination[spur];
+    }
+
+    // A* com a distância da árvore reversa como heurística (admissível e consistente)
+    for (int k = 0; k < numTouched; ++k) {
+        gScore[touched[k]] = INT_MAX;
+        parent[touched[k]] = -1;
+    }
+    numTouched = 0;
+    openSet->clear();
+
+    gScore[spur] = 0;
+    touched[numTouched++] = spur;
+    openSet->pushOrDecrease(spur, distToDestination[spur]);
+
+    while (!openSet->isEmpty()) {
+        int u = openSet->extractMin();
+        if (u == destination) {
+            break;
+        }
+
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            int v = targets[e];
+            if (v == spur || blockedVertex[v] || (u == spur && blockedNext[v]) || distToDestination[v] == INT_MAX) {
+                continue;
+            }
+            int candidate = gScore[u] + costs[e];
+            if (candidate < gScore[v]) {
+                if (gScore[v] == INT_MAX) {
+                    touched[numTouched++] = v;
+                }
+                gScore[v] = candidate;
+                parent[v] = u;
+                openSet->pushOrDecrease(v, candidate + distToDestination[v]);
+            }
+        }
+    }
+
+    if (gScore[destination] == INT_MAX) {
+        return INT_MAX;
+    }
+
+    for (int v = destination; v != -1; v = parent[v]) {
+        spurLength++;
+    }
+    int position = offset + spurLength - 1;
+    for (int v = destination; v != -1; v = parent[v]) {
+        pathBuffer[position--] = v;
+    }
+    return gScore[destination];
+}
+
+bool KShortestPaths::isKnownPath(const int* nodes, int length) const {
+    const StoredPath* lists[2] = {accepted, candidates};
+    const int sizes[2] = {numAccepted, numCandidates};
+
+    for (int l = 0; l < 2; ++l) {
+        for (int p = 0; p < sizes[l]; ++p) {
+            const StoredPath& path = lists[l][p];
+            if (path.length != length) {
+                continue;
+            }
+            bool equal = true;
+            for (int i = 0; i < length && equal; ++i) {
+                equal = path.nodes[i] == nodes[i];
+            }
+            if (equal) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void KShortestPaths::appendPath(StoredPath*& list, int& size, int& capacity, const int* nodes, int length, int cost) {
+    if (size == capacity) {
+        int newCapacity = capacity == 0 ? 4 : capacity * 2;
+        StoredPath* newList = new StoredPath[newCapacity];
+        for (int i = 0; i < size; ++i) {
+            newList[i] = list[i];
+        }
+        delete[] list;
+        list = newList;
+        capacity = newCapacity;
+    }
+
+    StoredPath& path = list[size++];
+    path.nodes = new int[length];
+    for (int i = 0; i < length; ++i) {
+        path.nodes[i] = nodes[i];
+    }
+    path.length = length;
+    path.cost = cost;
+}
@@ -0,0 +1,85 @@
+#include "../../include/dataStructures/NeighborLists.h"
+
+NeighborLists::NeighborLists(int numVertices) : numVertices(numVertices), rank(nullptr) {
+    rows = new int*[numVertices];
+    degrees = new int[numVertices];
+    capacities = new int[numVertices];
+    for (int i = 0; i < numVertices; ++i) {
+        rows[i] = nullptr;
+        degrees[i] = 0;
+        capacities[i] = 0;
+    }
+}
+
+NeighborLists::~NeighborLists() {
+    for (int i = 0; i < numVertices; ++i) {
+        delete[] rows[i];
+    }
+    delete[] rows;
+    delete[] degrees;
+    delete[] capacities;
+    delete[] rank;
+}
+
+void NeighborLists::insert(int i, int j) {
+    int position = degrees[i];
+    while (position > 0 && keyOf(rows[i][position - 1]) >= keyOf(j)) {
+        if (rows[i][position - 1] == j) {
+            return;
+        }
+        position--;
+    }
+
+    if (degrees[i] == capacities[i]) {
+        int newCapacity = capacities[i] == 0 ? 4 : capacities[i] * 2;
+        int* newRow = new int[newCapacity];
+        for (int k = 0; k < degrees[i]; ++k) {
+            newRow[k] = rows[i][k];
+        }
+        delete[] rows[i];
+        rows[i] = newRow;
+        capacities[i] = newCapacity;
+    }
+
+    for (int k = degrees[i]; k > position; --k) {
+        rows[i][k] = rows[i][k - 1];
+    }
+    rows[i][position] = j;
+    degrees[i]++;
+}
+
+void NeighborLists::remove(int i, int j) {
+    for (int k = 0; k < degrees[i]; ++k) {
+        if (rows[i][k] == j) {
+            for (int m = k + 1; m < degrees[i]; ++m) {
+                rows[i][m - 1] = rows[i][m];
+            }
+            degrees[i]--;
+            return;
+        }
+    }
+}
+
+void NeighborLists::setOrder(const int* order) {
+    delete[] rank;
+    rank = nullptr;
+    if (order != nullptr) {
+        rank = new int[numVertices];
+        for (int v = 0; v < numVertices; ++v) {
+            rank[v] = order[v];
+        }
+    }
+
+    //* Ordenação por inserção: as linhas são curtas em grafos esparsos
+    for (int i = 0; i < numVertices; ++i) {
+        for (int k = 1; k < degrees[i]; ++k) {
+            int vertex = rows[i][k];
+            int m = k;
+            while (m > 0 && keyOf(rows[i][m - 1]) > keyOf(vertex)) {
+                rows[i][m] = rows[i][m - 1];
+                m--;
+            }
+            rows[i][m] = vertex;
+        }
+    }
+}
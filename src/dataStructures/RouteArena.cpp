@@ -0,0 +1,169 @@
+#include "../../include/dataStructures/RouteArena.h"
+#include <stdexcept>
+
+RouteArena::RouteArena() : numNodes(0), nodesCapacity(64), numPaths(0), pathsCapacity(16), numBuckets(32) {
+    nodes = new int[nodesCapacity];
+    offsets = new int[pathsCapacity];
+    lengths = new int[pathsCapacity];
+    hashes = new unsigned int[pathsCapacity];
+    buckets = new int[numBuckets];
+    for (int i = 0; i < numBuckets; ++i) {
+        buckets[i] = -1;
+    }
+
+    //* A rota vazia ocupa o ID 0
+    intern(nullptr, 0);
+}
+
+RouteArena::~RouteArena() {
+    delete[] nodes;
+    delete[] offsets;
+    delete[] lengths;
+    delete[] hashes;
+    delete[] buckets;
+}
+
+unsigned int RouteArena::hashPath(const int* path, int length) noexcept {
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned int>(path[i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+bool RouteArena::equals(int pathId, const int* path, int length) const noexcept {
+    if (lengths[pathId] != length) {
+        return false;
+    }
+    const int* stored = nodes + offsets[pathId];
+    for (int i = 0; i < length; ++i) {
+        if (stored[i] != path[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void RouteArena::growBuckets() {
+    delete[] buckets;
+    numBuckets *= 2;
+    buckets = new int[numBuckets];
+    for (int i = 0; i < numBuckets; ++i) {
+        buckets[i] = -1;
+    }
+    for (int id = 0; id < numPaths; ++id) {
+        int slot = static_cast<int>(hashes[id] & static_cast<unsigned int>(numBuckets - 1));
+        while (buckets[slot] != -1) {
+            slot = (slot + 1) & (numBuckets - 1);
+        }
+        buckets[slot] = id;
+    }
+}
+
+int RouteArena::intern(const int* path, int length) {
+    if (length < 0) {
+        throw std::invalid_argument("O tamanho da rota não pode ser negativo.");
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    unsigned int hash = hashPath(path, length);
+    int slot = static_cast<int>(hash & static_cast<unsigned int>(numBuckets - 1));
+    while (buckets[slot] != -1) {
+        int id = buckets[slot];
+        if (hashes[id] == hash && equals(id, path, length)) {
+            return id;
+        }
+        slot = (slot + 1) & (numBuckets - 1);
+    }
+
+    if (numNodes + length > nodesCapacity) {
+        int newCapacity = nodesCapacity * 2;
+        while (numNodes + length > newCapacity) {
+            newCapacity *= 2;
+        }
+        int* newNodes = new int[newCapacity];
+        for (int i = 0; i < numNodes; ++i) {
+            newNodes[i] = nodes[i];
+        }
+        delete[] nodes;
+        nodes = newNodes;
+        nodesCapacity = newCapacity;
+    }
+
+    if (numPaths == pathsCapacity) {
+        int newCapacity = pathsCapacity * 2;
+        int* newOffsets = new int[newCapacity];
+        int* newLengths = new int[newCapacity];
+        unsigned int* newHashes = new unsigned int[newCapacity];
+        for (int i = 0; i < numPaths; ++i) {
+            newOffsets[i] = offsets[i];
+            newLengths[i] = lengths[i];
+            newHashes[i] = hashes[i];
+        }
+        delete[] offsets;
+        delete[] lengths;
+        delete[] hashes;
+        offsets = newOffsets;
+        lengths = newLengths;
+        hashes = newHashes;
+        pathsCapacity = newCapacity;
+    }
+
+    int id = numPaths++;
+    offsets[id] = numNodes;
+    lengths[id] = length;
+    hashes[id] = hash;
+    for (int i = 0; i < length; ++i) {
+        nodes[numNodes++] = path[i];
+    }
+    buckets[slot] = id;
+
+    //* Fator de carga máximo de 1/2 para manter as sondagens curtas
+    if (2 * numPaths > numBuckets) {
+        growBuckets();
+    }
+    return id;
+}
+
+int RouteArena::intern(const RoutePath& route) {
+    if (route.isEmpty()) {
+        return 0;
+    }
+    return intern(route.begin(), route.getCurrentSize());
+}
+
+int RouteArena::getLength(int pathId) const {
+    if (pathId < 0 || pathId >= numPaths) {
+        throw std::out_of_range("ID de rota inválido.");
+    }
+    return lengths[pathId];
+}
+
+int RouteArena::getNode(int pathId, int hop) const {
+    if (pathId < 0 || pathId >= numPaths || hop < 0 || hop >= lengths[pathId]) {
+        throw std::out_of_range("Posição fora da rota.");
+    }
+    return nodes[offsets[pathId] + hop];
+}
+
+const int* RouteArena::getNodes(int pathId) const {
+    if (pathId < 0 || pathId >= numPaths) {
+        throw std::out_of_range("ID de rota inválido.");
+    }
+    return nodes + offsets[pathId];
+}
+
+RoutePath RouteArena::toPath(int pathId, int fromHop) const {
+    const int* path = getNodes(pathId);
+    return fromHop < lengths[pathId] ? RoutePath(path + fromHop, lengths[pathId] - fromHop) : RoutePath();
+}
+
+int RouteArena::getNumPaths() const noexcept {
+    return numPaths;
+}
+
+int RouteArena::getNumNodes() const noexcept {
+    return numNodes;
+}
@@ -0,0 +1,90 @@
+#include "../../include/dataStructures/RoutePath.h"
+#include <cstring>
+
+RoutePath::RoutePath(const int* nodes, int length) : RoutePath() {
+    for (int i = 0; i < length; ++i) {
+        addBack(nodes[i]);
+    }
+}
+
+RoutePath::RoutePath(const RoutePath& other) : RoutePath() {
+    copy(other);
+}
+
+RoutePath::RoutePath(RoutePath&& other) noexcept : RoutePath() {
+    *this = static_cast<RoutePath&&>(other);
+}
+
+RoutePath::~RoutePath() {
+    release();
+}
+
+RoutePath& RoutePath::operator=(const RoutePath& other) {
+    copy(other);
+    return *this;
+}
+
+RoutePath& RoutePath::operator=(RoutePath&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    // Rota no heap: o ponteiro é transferido; rota interna: os elementos são copiados
+    if (!other.isInline()) {
+        release();
+        data = other.data;
+        capacity = other.capacity;
+        head = other.head;
+        size = other.size;
+        other.data = other.inlineData;
+        other.capacity = INLINE_CAPACITY;
+    } else {
+        clear();
+        std::memcpy(data, other.data + other.head, sizeof(int) * other.size);
+        size = other.size;
+    }
+    other.clear();
+    return *this;
+}
+
+void RoutePath::copy(const RoutePath& other) {
+    if (this == &other) {
+        return;
+    }
+
+    clear();
+    if (other.size > capacity) {
+        release();
+        data = new int[other.size];
+        capacity = other.size;
+    }
+    std::memcpy(data, other.data + other.head, sizeof(int) * other.size);
+    size = other.size;
+}
+
+void RoutePath::makeRoom(bool atFront) {
+    int newCapacity = size + 1 > capacity / 2 ? capacity * 2 : capacity;
+    int* target = newCapacity == capacity ? data : new int[newCapacity];
+    int newHead = atFront ? newCapacity - size : 0;
+
+    //* memmove: com a mesma capacidade os trechos de origem e destino podem se sobrepor
+    std::memmove(target + newHead, data + head, sizeof(int) * size);
+    if (target != data) {
+        if (!isInline()) {
+            delete[] data;
+        }
+        data = target;
+        capacity = newCapacity;
+    }
+    head = newHead;
+}
+
+void RoutePath::release() noexcept {
+    if (!isInline()) {
+        delete[] data;
+    }
+    data = inlineData;
+    capacity = INLINE_CAPACITY;
+    head = 0;
+    size = 0;
+}
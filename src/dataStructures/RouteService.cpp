@@ -0,0 +1,286 @@
+#include "../../include/dataStructures/RouteService.h"
+#include "../../include/utils/ThreadPool.h"
+#include <algorithm>
+#include <climits>
+#include <stdexcept>
+#include <thread>
+
+RouteService::RouteService(const GraphExtended& graph, int numWorkers)
+    : numVertices(graph.getNumWarehouses()), offsets(nullptr), targets(nullptr), edges(nullptr), profiles(nullptr), numProfiles(graph.getNumLatencyProfiles()),
+      timeDependent(graph.getRoutingEngine() == TIME_DEPENDENT), workers(nullptr), numWorkers(numWorkers) {
+    if (numVertices <= 0) {
+        throw std::invalid_argument("O serviço de rotas precisa de um grafo não vazio.");
+    }
+    if (this->numWorkers <= 0) {
+        this->numWorkers = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    if (this->numWorkers <= 0) {
+        this->numWorkers = 1;
+    }
+
+    // Copia a topologia para CSR (vizinhos em ordem crescente, sem laços)
+    offsets = new int[numVertices + 1];
+    offsets[0] = 0;
+    for (int u = 0; u < numVertices; ++u) {
+        int degree = 0;
+        for (int v : graph.neighbors(u)) {
+            if (v != u) {
+                degree++;
+            }
+        }
+        offsets[u + 1] = offsets[u] + degree;
+    }
+    targets = new int[offsets[numVertices]];
+    edges = new EdgeInfo[offsets[numVertices]];
+    for (int u = 0; u < numVertices; ++u) {
+        int e = offsets[u];
+        for (int v : graph.neighbors(u)) {
+            if (v != u) {
+                targets[e] = v;
+                edges[e] = graph.getEdgeInfo(u, v);
+                e++;
+            }
+        }
+    }
+
+    if (numProfiles > 0) {
+        const LatencyProfile* source = graph.getLatencyProfiles();
+        profiles = new LatencyProfile[numProfiles];
+        for (int k = 0; k < numProfiles; ++k) {
+            profiles[k].numPoints = source[k].numPoints;
+            profiles[k].times = new int[source[k].numPoints];
+            profiles[k].latencies = new int[source[k].numPoints];
+            for (int p = 0; p < source[k].numPoints; ++p) {
+                profiles[k].times[p] = source[k].times[p];
+                profiles[k].latencies[p] = source[k].latencies[p];
+            }
+        }
+    }
+
+    workers = new Worker[this->numWorkers];
+    for (int t = 0; t < this->numWorkers; ++t) {
+        workers[t].distance = new int[numVertices];
+        workers[t].parent = new int[numVertices];
+        workers[t].settled = new bool[numVertices];
+        workers[t].heap = new IndexedMinHeap(numVertices);
+        workers[t].cache = new CacheEntry[CACHE_SLOTS];
+        workers[t].cacheHits = 0;
+        workers[t].cacheMisses = 0;
+    }
+}
+
+RouteService::~RouteService() {
+    for (int t = 0; t < numWorkers; ++t) {
+        delete[] workers[t].distance;
+        delete[] workers[t].parent;
+        delete[] workers[t].settled;
+        delete workers[t].heap;
+        delete[] workers[t].cache;
+    }
+    delete[] workers;
+
+    for (int k = 0; k < numProfiles; ++k) {
+        delete[] profiles[k].times;
+        delete[] profiles[k].latencies;
+    }
+    delete[] profiles;
+    delete[] offsets;
+    delete[] targets;
+    delete[] edges;
+}
+
+int RouteService::getNumWorkers() const noexcept {
+    return numWorkers;
+}
+
+int RouteService::getNumVertices() const noexcept {
+    return numVertices;
+}
+
+void RouteService::search(Worker& worker, int origin, double weightFactor, int time, int target) const {
+    int* distance = worker.distance;
+    int* parent = worker.parent;
+    bool* settled = worker.settled;
+    IndexedMinHeap& heap = *worker.heap;
+    for (int v = 0; v < numVertices; ++v) {
+        distance[v] = INT_MAX;
+        parent[v] = -1;
+        settled[v] = false;
+    }
+    heap.clear();
+
+    //* No modo dependente do tempo a distância guarda o instante de chegada; no estático, a latência acumulada
+    int start = timeDependent ? time : 0;
+    distance[origin] = start;
+    heap.pushOrDecrease(origin, start);
+
+    //* Heap ordenado por (distância, ID) e relaxamento estrito: mesma árvore do Dijkstra denso
+    while (!heap.isEmpty()) {
+        int u = heap.extractMin();
+        settled[u] = true;
+        if (u == target) {
+            break;
+        }
+
+        //* Armazéns fixados nunca são reabertos: o predecessor sempre foi fixado antes, então a árvore não tem ciclos
+        int departure = timeDependent ? distance[u] : time;
+        for (int e = offsets[u]; e < offsets[u + 1]; ++e) {
+            int v = targets[e];
+            if (settled[v]) {
+                continue;
+            }
+            //* Dependente do tempo: o peso é um acréscimo fixo por aresta, fora de L(t), para não quebrar FIFO
+            int cost = timeDependent ? GraphExtended::evaluateLatency(edges[e], profiles, departure) + GraphExtended::weightSurcharge(edges[e].baseLatency, edges[e].timeMultiplier, weightFactor)
+                                     : static_cast<int>(GraphExtended::evaluateLatency(edges[e], profiles, departure) * weightFactor);
+            int candidate = distance[u] + cost;
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                parent[v] = u;
+                heap.pushOrDecrease(v, candidate);
+            }
+        }
+    }
+}
+
+Route RouteService::buildRoute(const Worker& worker, int destination, int packageWeight, int time) const {
+    Route route;
+    if (worker.distance[destination] == INT_MAX) {
+        return route;
+    }
+
+    RoutePath path;
+    for (int current = destination; current != -1; current = worker.parent[current]) {
+        path.addFront(current);
+    }
+    route.totalLatency = timeDependent ? worker.distance[destination] - time : worker.distance[destination];
+    route.priority = GraphExtended::routePriority(path.getCurrentSize(), packageWeight, time);
+    route.path = std::move(path);
+    return route;
+}
+
+int RouteService::cacheSlot(int origin, int destination, int weight, int time) noexcept {
+    unsigned int hash = 2166136261u;
+    const int values[4] = {origin, destination, weight, time};
+    for (int value : values) {
+        hash ^= static_cast<unsigned int>(value);
+        hash *= 16777619u;
+    }
+    return static_cast<int>(hash & (CACHE_SLOTS - 1));
+}
+
+Route RouteService::findBestRoute(int origin, int destination, int packageWeight, int time, int workerId) {
+    if (workerId < 0 || workerId >= numWorkers) {
+        throw std::out_of_range("ID de trabalhador fora do intervalo do serviço de rotas.");
+    }
+    if (origin < 0 || origin >= numVertices || destination < 0 || destination >= numVertices || packageWeight < 1) {
+        return Route();
+    }
+
+    Worker& worker = workers[workerId];
+    CacheEntry& entry = worker.cache[cacheSlot(origin, destination, packageWeight, time)];
+    if (entry.valid && entry.origin == origin && entry.destination == destination && entry.weight == packageWeight && entry.time == time) {
+        worker.cacheHits++;
+        return entry.route;
+    }
+    worker.cacheMisses++;
+
+    double weightFactor = 1.0 + (packageWeight - 1) * 0.1;
+    search(worker, origin, weightFactor, time, destination);
+    Route route = buildRoute(worker, destination, packageWeight, time);
+
+    entry.origin = origin;
+    entry.destination = destination;
+    entry.weight = packageWeight;
+    entry.time = time;
+    entry.valid = true;
+    entry.route = route;
+    return route;
+}
+
+void RouteService::findBestRoutes(const int* origins, const int* destinations, const int* weights, int count, Route* routes, int time, ThreadPool& pool) {
+    if (pool.getNumThreads() > numWorkers) {
+        throw std::invalid_argument("O pool tem mais threads que o serviço de rotas tem trabalhadores.");
+    }
+    if (count <= 0) {
+        return;
+    }
+
+    // Agrupa os pares por (origem, peso)
+    int* order = new int[count];
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::sort(order, order + count, [origins, weights](int a, int b) {
+        if (origins[a] != origins[b]) {
+            return origins[a] < origins[b];
+        }
+        if (weights[a] != weights[b]) {
+            return weights[a] < weights[b];
+        }
+        return a < b;
+    });
+
+    int* groupStart = new int[count + 1];
+    int numGroups = 0;
+    for (int k = 0; k < count; ++k) {
+        if (k == 0 || origins[order[k]] != origins[order[k - 1]] || weights[order[k]] != weights[order[k - 1]]) {
+            groupStart[numGroups++] = k;
+        }
+    }
+    groupStart[numGroups] = count;
+
+    pool.parallelFor(0, numGroups, [&](int group, int workerId) {
+        int first = order[groupStart[group]];
+        int origin = origins[first];
+        int weight = weights[first];
+        if (origin < 0 || origin >= numVertices || weight < 1) {
+            return;
+        }
+
+        Worker& worker = workers[workerId];
+        search(worker, origin, 1.0 + (weight - 1) * 0.1, time, -1);
+        for (int k = groupStart[group]; k < groupStart[group + 1]; ++k) {
+            int i = order[k];
+            if (destinations[i] >= 0 && destinations[i] < numVertices) {
+                routes[i] = buildRoute(worker, destinations[i], weight, time);
+            }
+        }
+    });
+
+    delete[] order;
+    delete[] groupStart;
+}
+
+void RouteService::findShortestPathTree(int origin, int packageWeight, int time, int workerId, int* parent) {
+    if (workerId < 0 || workerId >= numWorkers) {
+        throw std::out_of_range("ID de trabalhador fora do intervalo do serviço de rotas.");
+    }
+    if (origin < 0 || origin >= numVertices) {
+        throw std::out_of_range("Armazém de origem fora do intervalo do serviço de rotas.");
+    }
+    if (packageWeight < 1) {
+        throw std::invalid_argument("O peso do pacote deve ser pelo menos 1.");
+    }
+
+    Worker& worker = workers[workerId];
+    search(worker, origin, 1.0 + (packageWeight - 1) * 0.1, time, -1);
+    for (int v = 0; v < numVertices; ++v) {
+        parent[v] = worker.distance[v] == INT_MAX ? -2 : worker.parent[v];
+    }
+}
+
+int RouteService::getCacheHits() const noexcept {
+    int total = 0;
+    for (int t = 0; t < numWorkers; ++t) {
+        total += workers[t].cacheHits;
+    }
+    return total;
+}
+
+int RouteService::getCacheMisses() const noexcept {
+    int total = 0;
+    for (int t = 0; t < numWorkers; ++t) {
+        total += workers[t].cacheMisses;
+    }
+    return total;
+}
@@ -0,0 +1,335 @@
+#include "../../include/dataStructures/RouteTable.h"
+#include "../../include/dataStructures/Graph.h"
+#include "../../include/dataStructures/GraphExtended.h"
+#include "../../include/dataStructures/RouteService.h"
+#include "../../include/utils/ThreadPool.h"
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+//@ Cabeçalho do arquivo binário da tabela (os vetores seguem logo após, alinhados a 4 bytes)
+const char RT_MAGIC[8] = {'T', 'P', '2', 'R', 'T', '\0', '\0', '\0'};
+const int RT_VERSION = 1;
+
+struct RouteTableHeader {
+    char magic[8];
+    int version;
+    int numVertices;
+    unsigned long long topologyHash;
+    int numLayers;
+    int reserved;
+};
+
+//@ Tipos de grafo misturados no hash (tabelas do grafo base e do estendido nunca se confundem)
+const int BASE_GRAPH_TAG = 1;
+const int EXTENDED_GRAPH_TAG = 2;
+
+//@ Mistura um inteiro de 32 bits no hash FNV-1a, byte a byte
+void mixHash(unsigned long long& hash, int value) {
+    for (int byte = 0; byte < 4; ++byte) {
+        hash ^= static_cast<unsigned long long>((value >> (8 * byte)) & 0xFF);
+        hash *= 1099511628211ULL;
+    }
+}
+
+void mixHash(unsigned long long& hash, double value) {
+    long long bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    mixHash(hash, static_cast<int>(bits & 0xFFFFFFFF));
+    mixHash(hash, static_cast<int>(bits >> 32));
+}
+
+//@ Número de inteiros dos predecessores de uma tabela
+size_t parentCount(int numVertices, int numLayers) {
+    return static_cast<size_t>(numLayers) * numVertices * numVertices;
+}
+
+} // namespace
+
+RouteTable::RouteTable()
+    : numVertices(0), numLayers(0), topologyHash(0), layerWeights(nullptr), parents(nullptr), mapping(nullptr), mappingSize(0), ownedData(nullptr) {}
+
+RouteTable::~RouteTable() {
+    if (mapping != nullptr) {
+        munmap(mapping, mappingSize);
+    }
+    delete[] ownedData;
+}
+
+RouteTable* RouteTable::allocate(int numVertices, const int* weights, int numLayers, unsigned long long hash) {
+    RouteTable* table = new RouteTable();
+    table->numVertices = numVertices;
+    table->numLayers = numLayers;
+    table->topologyHash = hash;
+    table->ownedData = new int[numLayers + parentCount(numVertices, numLayers)];
+    for (int k = 0; k < numLayers; ++k) {
+        table->ownedData[k] = weights[k];
+    }
+    table->layerWeights = table->ownedData;
+    table->parents = table->ownedData + numLayers;
+    return table;
+}
+
+RouteTable* RouteTable::build(const Graph& graph, int numThreads) {
+    int n = graph.getNumWarehouses();
+    if (n <= 0) {
+        throw std::invalid_argument("A tabela de rotas precisa de um grafo não vazio.");
+    }
+
+    //* O grafo base não diferencia pesos: uma única camada, de peso 1
+    const int weight = 1;
+    RouteTable* table = allocate(n, &weight, 1, computeTopologyHash(graph));
+    int* parents = table->ownedData + 1;
+
+    ThreadPool pool(numThreads);
+    int** queues = new int*[pool.getNumThreads()];
+    for (int t = 0; t < pool.getNumThreads(); ++t) {
+        queues[t] = new int[n];
+    }
+
+    pool.parallelFor(0, n, [&](int origin, int worker) {
+        graph.buildBfsTree(origin, parents + static_cast<size_t>(origin) * n, queues[worker]);
+    });
+
+    for (int t = 0; t < pool.getNumThreads(); ++t) {
+        delete[] queues[t];
+    }
+    delete[] queues;
+    return table;
+}
+
+RouteTable* RouteTable::build(const GraphExtended& graph, const int* weights, int numWeights, int numThreads) {
+    int n = graph.getNumWarehouses();
+    if (n <= 0) {
+        throw std::invalid_argument("A tabela de rotas precisa de um grafo não vazio.");
+    }
+    if (numWeights <= 0) {
+        throw std::invalid_argument("A tabela de rotas precisa de pelo menos um peso.");
+    }
+
+    RouteTable* table = allocate(n, weights, numWeights, computeTopologyHash(graph));
+    int* parents = table->ownedData + numWeights;
+
+    ThreadPool pool(numThreads);
+    RouteService service(graph, pool.getNumThreads());
+
+    pool.parallelFor(0, numWeights * n, [&](int task, int worker) {
+        int layer = task / n;
+        int origin = task % n;
+        service.findShortestPathTree(origin, weights[layer], 0, worker, parents + (static_cast<size_t>(layer) * n + origin) * n);
+    });
+    return table;
+}
+
+RouteTable* RouteTable::loadFromFile(const std::string& filename, unsigned long long expectedHash) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(RouteTableHeader)) {
+        close(fd);
+        return nullptr;
+    }
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    //* Arquivo de outra versão, de outra topologia ou truncado é ignorado (o chamador recalcula as rotas)
+    const RouteTableHeader* header = static_cast<const RouteTableHeader*>(mapping);
+    bool valid = std::memcmp(header->magic, RT_MAGIC, sizeof(RT_MAGIC)) == 0 && header->version == RT_VERSION && header->numVertices > 0 && header->numLayers > 0 &&
+                 header->topologyHash == expectedHash &&
+                 size == sizeof(RouteTableHeader) + sizeof(int) * (header->numLayers + parentCount(header->numVertices, header->numLayers));
+    if (!valid) {
+        munmap(mapping, size);
+        return nullptr;
+    }
+
+    RouteTable* table = new RouteTable();
+    table->numVertices = header->numVertices;
+    table->numLayers = header->numLayers;
+    table->topologyHash = header->topologyHash;
+    table->mapping = mapping;
+    table->mappingSize = size;
+    table->layerWeights = reinterpret_cast<const int*>(header + 1);
+    table->parents = table->layerWeights + table->numLayers;
+    if (!table->hasValidStructure()) {
+        delete table;
+        return nullptr;
+    }
+    return table;
+}
+
+bool RouteTable::hasValidStructure() const {
+    int n = numVertices;
+    //* Estado de cada armazém na linha: 0 não visto, 1 na cadeia atual, 2 chega à origem, 3 inalcançável
+    std::vector<unsigned char> status(n);
+    std::vector<int> chain;
+    chain.reserve(n);
+
+    for (int layer = 0; layer < numLayers; ++layer) {
+        for (int origin = 0; origin < n; ++origin) {
+            const int* parent = parents + (static_cast<size_t>(layer) * n + origin) * n;
+            if (parent[origin] != -1) {
+                return false;
+            }
+            std::fill(status.begin(), status.end(), 0);
+            status[origin] = 2;
+
+            for (int v = 0; v < n; ++v) {
+                if (parent[v] == -2) {
+                    status[v] = 3;
+                }
+            }
+
+            // Cada armazém é percorrido uma vez por linha: as cadeias param no primeiro já resolvido
+            for (int v = 0; v < n; ++v) {
+                chain.clear();
+                int current = v;
+                while (status[current] == 0) {
+                    status[current] = 1;
+                    chain.push_back(current);
+                    int next = parent[current];
+                    if (next < 0 || next >= n) {
+                        return false; // -1 fora da origem, -2 no meio da cadeia ou fora do intervalo
+                    }
+                    current = next;
+                }
+                if (status[current] != 2) {
+                    return false; // Ciclo (1) ou cadeia que passa por um armazém inalcançável (3)
+                }
+                for (int node : chain) {
+                    status[node] = 2;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool RouteTable::saveToFile(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    RouteTableHeader header = {};
+    std::memcpy(header.magic, RT_MAGIC, sizeof(RT_MAGIC));
+    header.version = RT_VERSION;
+    header.numVertices = numVertices;
+    header.topologyHash = topologyHash;
+    header.numLayers = numLayers;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(layerWeights), sizeof(int) * numLayers);
+    file.write(reinterpret_cast<const char*>(parents), sizeof(int) * parentCount(numVertices, numLayers));
+
+    return static_cast<bool>(file);
+}
+
+unsigned long long RouteTable::computeTopologyHash(const Graph& graph) {
+    unsigned long long hash = 14695981039346656037ULL;
+    mixHash(hash, BASE_GRAPH_TAG);
+
+    //* A ordem dos vizinhos entra no hash porque decide os desempates da BFS
+    int n = graph.getNumWarehouses();
+    mixHash(hash, n);
+    for (int i = 0; i < n; ++i) {
+        mixHash(hash, -1);
+        for (int j : graph.neighbors(i)) {
+            mixHash(hash, j);
+        }
+    }
+    return hash;
+}
+
+unsigned long long RouteTable::computeTopologyHash(const GraphExtended& graph) {
+    unsigned long long hash = 14695981039346656037ULL;
+    mixHash(hash, EXTENDED_GRAPH_TAG);
+
+    int n = graph.getNumWarehouses();
+    mixHash(hash, n);
+    mixHash(hash, graph.getRoutingEngine() == TIME_DEPENDENT ? 1 : 0);
+    for (int i = 0; i < n; ++i) {
+        for (int j : graph.neighbors(i)) {
+            EdgeInfo edge = graph.getEdgeInfo(i, j);
+            mixHash(hash, i);
+            mixHash(hash, j);
+            mixHash(hash, edge.baseLatency);
+            mixHash(hash, edge.timeMultiplier);
+            mixHash(hash, edge.profileIndex);
+        }
+    }
+
+    const LatencyProfile* profiles = graph.getLatencyProfiles();
+    for (int k = 0; k < graph.getNumLatencyProfiles(); ++k) {
+        mixHash(hash, profiles[k].numPoints);
+        for (int p = 0; p < profiles[k].numPoints; ++p) {
+            mixHash(hash, profiles[k].times[p]);
+            mixHash(hash, profiles[k].latencies[p]);
+        }
+    }
+    return hash;
+}
+
+int RouteTable::getNumVertices() const noexcept {
+    return numVertices;
+}
+
+int RouteTable::getNumLayers() const noexcept {
+    return numLayers;
+}
+
+unsigned long long RouteTable::getTopologyHash() const noexcept {
+    return topologyHash;
+}
+
+int RouteTable::findLayer(int weight) const noexcept {
+    for (int k = 0; k < numLayers; ++k) {
+        if (layerWeights[k] == weight) {
+            return k;
+        }
+    }
+    return -1;
+}
+
+bool RouteTable::isMapped() const noexcept {
+    return mapping != nullptr;
+}
+
+int RouteTable::writePath(int layer, int origin, int destination, int* path) const {
+    if (layer < 0 || layer >= numLayers || origin < 0 || origin >= numVertices || destination < 0 || destination >= numVertices) {
+        return 0;
+    }
+
+    const int* parent = parents + (static_cast<size_t>(layer) * numVertices + origin) * numVertices;
+    if (parent[destination] == -2) {
+        return 0;
+    }
+
+    // Conta os saltos e depois preenche de trás para frente (no máximo numVertices armazéns, mesmo com a tabela corrompida)
+    int length = 0;
+    for (int crawl = destination; crawl != -1; crawl = parent[crawl]) {
+        if (crawl < 0 || crawl >= numVertices || ++length > numVertices) {
+            return 0;
+        }
+    }
+    int position = length;
+    for (int crawl = destination; crawl != -1; crawl = parent[crawl]) {
+        path[--position] = crawl;
+    }
+    return length;
+}
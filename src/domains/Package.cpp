@@ -1,69 +1,88 @@
 #include "../include/domains/Package.h"
-
-//* O estado inicial sempre é NOT_POSTED, pois o pacote ainda não foi postado
-Package::Package(int ID, int initialOrigin, int finalDestination, int postTime)
-    : ID(ID), initialOrigin(initialOrigin), finalDestination(finalDestination), postTime(postTime), timeStored(0), timeInTransit(0), state(PackageState::NOT_POSTED) {}
+#include "../include/dataStructures/RouteTable.h"
+#include "../include/utils/ThreadPool.h"
+#include <algorithm>
 
 int Package::getId() const noexcept {
-    return this->ID;
+    return this->table->ids[this->index];
+}
+
+int Package::getIndex() const noexcept {
+    return this->index;
 }
 
 int Package::getInitialOrigin() const noexcept {
-    return this->initialOrigin;
+    return this->table->initialOrigins[this->index];
 }
 
 int Package::getFinalDestination() const noexcept {
-    return this->finalDestination;
+    return this->table->finalDestinations[this->index];
 }
 
 int Package::getPostTime() const noexcept {
-    return this->postTime;
+    return this->table->postTimes[this->index];
 }
 
-int Package::getTimeStored() const noexcept {
-    return this->timeStored;
+int Package::getCurrentLocation() const noexcept {
+    return this->table->currentLocations[this->index];
 }
 
-int Package::getTimeInTransit() const noexcept {
-    return this->timeInTransit;
+PackageState Package::getState() const noexcept {
+    return static_cast<PackageState>(this->table->states[this->index]);
 }
 
-int Package::getCurrentLocation() const noexcept {
-    return this->currentLocation;
+int Package::getRouteId() const noexcept {
+    return this->table->routeIds[this->index];
 }
 
-PackageState Package::getState() const noexcept {
-    return this->state;
+int Package::getRouteHop() const noexcept {
+    return this->table->routeHops[this->index];
+}
+
+RouteArena& Package::getRouteArena() const noexcept {
+    return *this->table->routes;
 }
 
-LinkedList& Package::getRoute() noexcept {
-    return this->route;
+int Package::getRemainingRouteSize() const {
+    return this->table->routes->getLength(getRouteId()) - getRouteHop();
 }
 
-void Package::setTimeInTransit(int time) {
-    this->timeInTransit = time;
+RoutePath Package::getRoute() const {
+    return this->table->routes->toPath(getRouteId(), getRouteHop());
+}
+
+int Package::peekRoute(int ahead) const {
+    return this->table->routes->getNode(getRouteId(), getRouteHop() + ahead);
+}
+
+void Package::advanceRoute() {
+    if (getRemainingRouteSize() <= 0) {
+        throw std::out_of_range("Nao e possivel avancar uma rota vazia.");
+    }
+    this->table->routeHops[this->index]++;
 }
 
 void Package::setCurrentLocation(int location) {
-    this->currentLocation = location;
+    this->table->currentLocations[this->index] = location;
 }
 
-void Package::setTimeStored(int time) {
-    this->timeStored = time;
+void Package::setRoute(int pathId, int hop) noexcept {
+    this->table->routeIds[this->index] = pathId;
+    this->table->routeHops[this->index] = hop;
 }
 
-void Package::setRoute(LinkedList&& newRoute) noexcept {
-    this->route = std::move(newRoute);
+void Package::setRoute(const RoutePath& newRoute) {
+    setRoute(this->table->routes->intern(newRoute));
 }
 
 void Package::setState(PackageState newState) noexcept {
-    this->state = newState;
+    this->table->states[this->index] = newState;
 }
 
 namespace Routing {
-LinkedList calculateOptimalRoute(int originId, int destinationId, const Graph& graph) {
+RoutePath calculateOptimalRoute(int originId, int destinationId, const Graph& graph) {
     int numWarehouses = graph.getNumWarehouses();
-    LinkedList finalRoute;
+    RoutePath finalRoute;
 
     if (originId == destinationId) {
         finalRoute.addFront(originId);
@@ -72,58 +91,197 @@ LinkedList calculateOptimalRoute(int originId, int destinationId, const Graph& g
 
     bool* visited = new bool[numWarehouses];
     int* predecessor = new int[numWarehouses];
+    int* bfsQueue = new int[numWarehouses];
     for (int i = 0; i < numWarehouses; ++i) {
         visited[i] = false;
         predecessor[i] = -1;
     }
 
-    LinkedList bfsQueue;
-
+    //* Cada armazém entra na fila no máximo uma vez, então um vetor de numWarehouses basta
+    int head = 0;
+    int tail = 0;
     visited[originId] = true;
-    bfsQueue.addBack(originId);
+    bfsQueue[tail++] = originId;
 
     bool pathFound = false;
-    while (!bfsQueue.isEmpty()) {
-        int currentWarehouse = bfsQueue.peekFront();
-        bfsQueue.removeFront();
+    while (head < tail) {
+        int currentWarehouse = bfsQueue[head++];
 
         if (currentWarehouse == destinationId) {
             pathFound = true;
             break;
         }
 
-        LinkedList neighbors = graph.getNeighbors(currentWarehouse);
-
-        while (!neighbors.isEmpty()) {
-            int neighbor = neighbors.peekFront();
-            neighbors.removeFront();
-
+        for (int neighbor : graph.neighbors(currentWarehouse)) {
             if (!visited[neighbor]) {
                 visited[neighbor] = true;
                 predecessor[neighbor] = currentWarehouse;
-                bfsQueue.addBack(neighbor);
+                bfsQueue[tail++] = neighbor;
             }
         }
     }
 
     if (pathFound) {
-        LinkedList reversedPath;
-        int crawl = destinationId;
+        for (int crawl = destinationId; crawl != -1; crawl = predecessor[crawl]) {
+            finalRoute.addFront(crawl);
+        }
+    }
+
+    delete[] visited;
+    delete[] predecessor;
+    delete[] bfsQueue;
+
+    return finalRoute;
+}
+
+void calculateRoutes(PackageTable& packages, const Graph& graph, ThreadPool& pool, const RouteTable* table) {
+    int numPackages = packages.getSize();
+    RouteArena& arena = packages.getRoutes();
+    int numWarehouses = graph.getNumWarehouses();
+    if (numPackages <= 0 || numWarehouses <= 0) {
+        return;
+    }
 
-        while (crawl != -1) {
-            reversedPath.addFront(crawl);
-            crawl = predecessor[crawl];
+    // Com a tabela basta percorrer os predecessores já salvos (as árvores são as mesmas da BFS abaixo)
+    if (table != nullptr && table->getNumVertices() == numWarehouses && table->findLayer(1) != -1) {
+        int layer = table->findLayer(1);
+        int* path = new int[numWarehouses];
+        for (int i = 0; i < numPackages; ++i) {
+            Package pkg(packages, i);
+            pkg.setRoute(arena.intern(path, table->writePath(layer, pkg.getInitialOrigin(), pkg.getFinalDestination(), path)));
         }
+        delete[] path;
+        return;
+    }
 
-        while (!reversedPath.isEmpty()) {
-            int nodeId = reversedPath.peekFront();
-            reversedPath.removeFront();
-            finalRoute.addBack(nodeId);
+    // Agrupa os pacotes por origem (ordenação por contagem)
+    int* groupStart = new int[numWarehouses + 1];
+    int* members = new int[numPackages];
+    for (int i = 0; i <= numWarehouses; ++i) {
+        groupStart[i] = 0;
+    }
+    for (int i = 0; i < numPackages; ++i) {
+        int origin = Package(packages, i).getInitialOrigin();
+        if (origin >= 0 && origin < numWarehouses) {
+            groupStart[origin + 1]++;
+        }
+    }
+    for (int i = 0; i < numWarehouses; ++i) {
+        groupStart[i + 1] += groupStart[i];
+    }
+    int* fill = new int[numWarehouses];
+    for (int i = 0; i < numWarehouses; ++i) {
+        fill[i] = groupStart[i];
+    }
+    for (int i = 0; i < numPackages; ++i) {
+        int origin = Package(packages, i).getInitialOrigin();
+        if (origin >= 0 && origin < numWarehouses) {
+            members[fill[origin]++] = i;
         }
     }
+    delete[] fill;
+
+    int numWorkers = pool.getNumThreads();
+
+    // Vetores de trabalho de cada thread: predecessores, fila da BFS e caminho em montagem
+    int** predecessor = new int*[numWorkers];
+    int** bfsQueue = new int*[numWorkers];
+    int** pathBuffer = new int*[numWorkers];
+    for (int t = 0; t < numWorkers; ++t) {
+        predecessor[t] = new int[numWarehouses];
+        bfsQueue[t] = new int[numWarehouses];
+        pathBuffer[t] = new int[numWarehouses];
+    }
+
+    pool.parallelFor(0, numWarehouses, [&](int origin, int worker) {
+        if (groupStart[origin] == groupStart[origin + 1]) {
+            return;
+        }
+
+        int* parent = predecessor[worker];
+        graph.buildBfsTree(origin, parent, bfsQueue[worker]);
+
+        for (int k = groupStart[origin]; k < groupStart[origin + 1]; ++k) {
+            Package pkg(packages, members[k]);
+            int destination = pkg.getFinalDestination();
 
+            // O caminho é montado de trás para frente no buffer e internado direto
+            int* path = pathBuffer[worker];
+            int start = numWarehouses;
+            if (destination >= 0 && destination < numWarehouses && parent[destination] != -2) {
+                for (int crawl = destination; crawl != -1; crawl = parent[crawl]) {
+                    path[--start] = crawl;
+                }
+            }
+            pkg.setRoute(arena.intern(path + start, numWarehouses - start));
+        }
+    });
+
+    for (int t = 0; t < numWorkers; ++t) {
+        delete[] predecessor[t];
+        delete[] bfsQueue[t];
+        delete[] pathBuffer[t];
+    }
     delete[] predecessor;
+    delete[] bfsQueue;
+    delete[] pathBuffer;
+    delete[] groupStart;
+    delete[] members;
+}
+OnDemandRouter::OnDemandRouter(const Graph& graph, RouteArena& arena, const RouteTable* table, int numSlots) : graph(graph), arena(arena), table(nullptr), numSlots(0), slotOrigin(nullptr), slotParent(nullptr) {
+    int numWarehouses = graph.getNumWarehouses();
+    if (table != nullptr && table->getNumVertices() == numWarehouses && table->findLayer(1) != -1) {
+        this->table = table;
+    }
 
-    return finalRoute;
+    //* Com a tabela nenhuma árvore precisa ser guardada
+    if (this->table == nullptr) {
+        this->numSlots = std::max(1, std::min(numSlots, numWarehouses));
+        slotOrigin = new int[this->numSlots];
+        slotParent = new int*[this->numSlots];
+        for (int s = 0; s < this->numSlots; ++s) {
+            slotOrigin[s] = -1;
+            slotParent[s] = new int[numWarehouses];
+        }
+    }
+    bfsQueue = new int[numWarehouses];
+    pathBuffer = new int[numWarehouses];
+}
+
+OnDemandRouter::~OnDemandRouter() {
+    for (int s = 0; s < numSlots; ++s) {
+        delete[] slotParent[s];
+    }
+    delete[] slotParent;
+    delete[] slotOrigin;
+    delete[] bfsQueue;
+    delete[] pathBuffer;
+}
+
+int OnDemandRouter::route(int origin, int destination) {
+    int numWarehouses = graph.getNumWarehouses();
+    if (origin < 0 || origin >= numWarehouses || destination < 0 || destination >= numWarehouses) {
+        return 0;
+    }
+
+    if (table != nullptr) {
+        return arena.intern(pathBuffer, table->writePath(table->findLayer(1), origin, destination, pathBuffer));
+    }
+
+    int slot = origin % numSlots;
+    int* parent = slotParent[slot];
+    if (slotOrigin[slot] != origin) {
+        graph.buildBfsTree(origin, parent, bfsQueue);
+        slotOrigin[slot] = origin;
+    }
+    if (parent[destination] == -2) {
+        return 0;
+    }
+
+    int start = numWarehouses;
+    for (int crawl = destination; crawl != -1; crawl = parent[crawl]) {
+        pathBuffer[--start] = crawl;
+    }
+    return arena.intern(pathBuffer + start, numWarehouses - start);
 }
-} // namespace Routing
\ No newline at end of file
+} // namespace Routing
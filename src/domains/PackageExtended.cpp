@@ -1,45 +1,40 @@
 #include "../../include/domains/PackageExtended.h"
 #include <cmath>
 
-PackageExtended::PackageExtended(int ID, int initialOrigin, int finalDestination, int postTime, int weight, bool specialHandling)
-    : Package(ID, initialOrigin, finalDestination, postTime), weight(weight), lastRouteCalculation(0), requiresSpecialHandling(specialHandling) {
-    this->weightClass = determineWeightClass(weight);
-}
-
 int PackageExtended::getWeight() const noexcept {
-    return weight;
+    return this->table->weights[this->index];
 }
 
 PackageWeightClass PackageExtended::getWeightClass() const noexcept {
-    return weightClass;
+    return determineWeightClass(getWeight());
 }
 
 bool PackageExtended::getRequiresSpecialHandling() const noexcept {
-    return requiresSpecialHandling;
+    return this->table->specialHandling[this->index];
 }
 
-const LinkedList& PackageExtended::getRouteHistory() const noexcept {
-    return routeHistory;
+int PackageExtended::getPreviousRouteSize() const {
+    return getRouteArena().getLength(this->table->previousRouteIds[this->index]) - this->table->previousRouteHops[this->index];
 }
 
 int PackageExtended::getLastRouteCalculation() const noexcept {
-    return lastRouteCalculation;
+    return this->table->lastRouteCalculations[this->index];
 }
 
-void PackageExtended::addRouteToHistory(const LinkedList& route) {
-    // Add route to history - simplified implementation
-    // In practice, you might want to limit the history size
-    routeHistory = route;
+void PackageExtended::saveRouteAsPrevious() noexcept {
+    // As rotas são internadas: basta guardar o ID do caminho e a posição, sem copiar os armazéns
+    this->table->previousRouteIds[this->index] = getRouteId();
+    this->table->previousRouteHops[this->index] = getRouteHop();
 }
 
 void PackageExtended::updateLastRouteCalculation(int time) {
-    lastRouteCalculation = time;
+    this->table->lastRouteCalculations[this->index] = time;
 }
 
 double PackageExtended::getWeightImpactFactor() const noexcept {
     // Weight impact factor for transport calculations
     // Heavier packages take more time/resources
-    switch (weightClass) {
+    switch (getWeightClass()) {
     case LIGHT:
         return 1.0;
     case MEDIUM:
@@ -56,7 +51,7 @@ double PackageExtended::getWeightImpactFactor() const noexcept {
 int PackageExtended::getStorageSpaceRequired() const noexcept {
     // Storage space required based on weight class
     // Heavier packages require more space
-    switch (weightClass) {
+    switch (getWeightClass()) {
     case LIGHT:
         return 1;
     case MEDIUM:
@@ -70,7 +65,7 @@ int PackageExtended::getStorageSpaceRequired() const noexcept {
     }
 }
 
-PackageWeightClass PackageExtended::determineWeightClass(int weight) {
+PackageWeightClass PackageExtended::determineWeightClass(int weight) noexcept {
     if (weight <= 1)
         return LIGHT;
     else if (weight <= 3)
@@ -0,0 +1,135 @@
+#include "../../include/domains/PackageTable.h"
+#include "../../include/utils/RegionArena.h"
+#include <stdexcept>
+
+template <typename T>
+T* PackageTable::allocateColumn() {
+    if (arena != nullptr) {
+        return arena->allocateArray<T>(capacity);
+    }
+    return new T[capacity];
+}
+
+PackageTable::PackageTable(int capacity, RouteArena& routes, RegionArena* arena, bool extended)
+    : capacity(capacity), size(0), weights(nullptr), specialHandling(nullptr), lastRouteCalculations(nullptr), previousRouteIds(nullptr), previousRouteHops(nullptr), routes(&routes),
+      arena(arena) {
+    if (capacity < 0) {
+        throw std::invalid_argument("A capacidade da tabela de pacotes não pode ser negativa.");
+    }
+
+    // Colunas quentes primeiro e contíguas, depois as frias e as estendidas
+    states = allocateColumn<std::uint8_t>();
+    currentLocations = allocateColumn<std::int32_t>();
+    routeIds = allocateColumn<std::int32_t>();
+    routeHops = allocateColumn<std::int32_t>();
+    links = allocateColumn<std::int32_t>();
+    ids = allocateColumn<std::int32_t>();
+    initialOrigins = allocateColumn<std::int32_t>();
+    finalDestinations = allocateColumn<std::int32_t>();
+    postTimes = allocateColumn<std::int32_t>();
+    if (extended) {
+        weights = allocateColumn<std::uint8_t>();
+        specialHandling = allocateColumn<std::uint8_t>();
+        lastRouteCalculations = allocateColumn<std::int32_t>();
+        previousRouteIds = allocateColumn<std::int32_t>();
+        previousRouteHops = allocateColumn<std::int32_t>();
+    }
+}
+
+PackageTable::~PackageTable() {
+    if (arena != nullptr) {
+        return;
+    }
+    delete[] states;
+    delete[] currentLocations;
+    delete[] routeIds;
+    delete[] routeHops;
+    delete[] links;
+    delete[] ids;
+    delete[] initialOrigins;
+    delete[] finalDestinations;
+    delete[] postTimes;
+    delete[] weights;
+    delete[] specialHandling;
+    delete[] lastRouteCalculations;
+    delete[] previousRouteIds;
+    delete[] previousRouteHops;
+}
+
+int PackageTable::add(int ID, int initialOrigin, int finalDestination, int postTime) {
+    if (size == capacity) {
+        throw std::length_error("A tabela de pacotes está cheia.");
+    }
+
+    //* O estado inicial sempre é NOT_POSTED, pois o pacote ainda não foi postado; a localização começa na origem
+    int index = size++;
+    states[index] = PackageState::NOT_POSTED;
+    currentLocations[index] = initialOrigin;
+    routeIds[index] = 0;
+    routeHops[index] = 0;
+    links[index] = -1;
+    ids[index] = ID;
+    initialOrigins[index] = initialOrigin;
+    finalDestinations[index] = finalDestination;
+    postTimes[index] = postTime;
+    return index;
+}
+
+int PackageTable::addExtended(int ID, int initialOrigin, int finalDestination, int postTime, int weight, bool requiresSpecialHandling) {
+    if (!isExtended()) {
+        throw std::logic_error("A tabela de pacotes não tem as colunas estendidas.");
+    }
+    if (weight < 0 || weight > UINT8_MAX) {
+        throw std::out_of_range("Peso de pacote fora do intervalo da tabela.");
+    }
+
+    int index = add(ID, initialOrigin, finalDestination, postTime);
+    weights[index] = static_cast<std::uint8_t>(weight);
+    specialHandling[index] = requiresSpecialHandling;
+    lastRouteCalculations[index] = 0;
+    previousRouteIds[index] = 0;
+    previousRouteHops[index] = 0;
+    return index;
+}
+
+int PackageTable::getSize() const noexcept {
+    return size;
+}
+
+int PackageTable::getCapacity() const noexcept {
+    return capacity;
+}
+
+bool PackageTable::isExtended() const noexcept {
+    return weights != nullptr;
+}
+
+RouteArena& PackageTable::getRoutes() const noexcept {
+    return *routes;
+}
+
+const std::uint8_t* PackageTable::getStates() const noexcept {
+    return states;
+}
+
+const std::int32_t* PackageTable::getPostTimes() const noexcept {
+    return postTimes;
+}
+
+int PackageTable::countInState(PackageState state) const noexcept {
+    // Blocos de tamanho fixo: com o número de iterações conhecido o laço interno vetoriza mesmo em -O2
+    constexpr int BLOCK = 64;
+    int count = 0;
+    int i = 0;
+    for (; i + BLOCK <= size; i += BLOCK) {
+        unsigned char matches = 0;
+        for (int j = 0; j < BLOCK; ++j) {
+            matches += states[i + j] == state;
+        }
+        count += matches;
+    }
+    for (; i < size; ++i) {
+        count += states[i] == state;
+    }
+    return count;
+}
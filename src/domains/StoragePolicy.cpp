@@ -0,0 +1,29 @@
+#include "../../include/domains/StoragePolicy.h"
+
+namespace {
+const StoragePolicy allPolicies[] = {LIFO_STORAGE, FIFO_STORAGE, AGE_PRIORITY_STORAGE, WEIGHT_ORDERED_STORAGE};
+} // namespace
+
+const char* storagePolicyName(StoragePolicy policy) noexcept {
+    switch (policy) {
+    case FIFO_STORAGE:
+        return "fifo";
+    case AGE_PRIORITY_STORAGE:
+        return "idade";
+    case WEIGHT_ORDERED_STORAGE:
+        return "peso";
+    case LIFO_STORAGE:
+    default:
+        return "lifo";
+    }
+}
+
+bool parseStoragePolicy(const std::string& name, StoragePolicy& policy) {
+    for (StoragePolicy candidate : allPolicies) {
+        if (name == storagePolicyName(candidate)) {
+            policy = candidate;
+            return true;
+        }
+    }
+    return false;
+}
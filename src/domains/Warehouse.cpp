@@ -1,15 +1,37 @@
 #include "../include/domains/Warehouse.h"
+#include "../include/domains/Package.h"
+#include "../include/utils/RegionArena.h"
+#include <algorithm>
 
-Warehouse::Warehouse(int ID, int totalWarehouses) : ID(ID), totalWarehouses(totalWarehouses) {
-    this->sessions = new Session[totalWarehouses];
+namespace {
+//* Pilha vazia devolvida nas consultas a destinos sem seção (peek lança a mesma exceção de uma seção vazia)
+const IntrusiveStack emptySection;
+} // namespace
 
-    for (int i = 0; i < totalWarehouses; ++i) {
-        this->sessions[i].destinationId = i;
+Warehouse::Warehouse(int ID, int totalWarehouses, NeighborView neighbors, RegionArena* arena, StoragePolicy storagePolicy)
+    : ID(ID), sessions(neighbors, arena), totalWarehouses(totalWarehouses), storagePolicy(storagePolicy) {}
+
+Warehouse::~Warehouse() {}
+
+Warehouse::Session* Warehouse::sessionFor(int destinationId) {
+    if (destinationId < 0 || destinationId >= this->totalWarehouses) {
+        return nullptr;
+    }
+    Session* session = this->sessions.find(destinationId);
+    if (session == nullptr) {
+        session = &this->sessions.insert(destinationId);
     }
+    return session;
 }
 
-Warehouse::~Warehouse() {
-    delete[] this->sessions;
+IntrusiveStack* Warehouse::sectionFor(int destinationId) {
+    Session* session = sessionFor(destinationId);
+    return session ? &session->stack : nullptr;
+}
+
+const IntrusiveStack& Warehouse::sectionAt(int destinationId) const noexcept {
+    const Session* session = this->sessions.find(destinationId);
+    return session ? session->stack : emptySection;
 }
 
 int Warehouse::getId() const noexcept {
@@ -17,35 +39,80 @@ int Warehouse::getId() const noexcept {
 }
 
 int Warehouse::getSectionSize(int sectionId) const noexcept {
-    if (sectionId >= 0 && sectionId < this->totalWarehouses) {
-        return this->sessions[sectionId].stack.getCurrentSize();
+    return sectionAt(sectionId).getCurrentSize(); // 0 se a seção não existir
+}
+
+StoragePolicy Warehouse::getStoragePolicy() const noexcept {
+    return this->storagePolicy;
+}
+
+void Warehouse::storePackage(const Package& pkg, int destinationId) {
+    Session* session = sessionFor(destinationId);
+    if (!session) {
+        return;
+    }
+    IntrusiveStack* stack = &session->stack;
+
+    switch (this->storagePolicy) {
+    case LIFO_STORAGE:
+        stack->push(pkg);
+        break;
+    case AGE_PRIORITY_STORAGE: {
+        int size = stack->getCurrentSize();
+        int above = stack->insertOrdered(pkg, [](const Package& a, const Package& b) { return a.getPostTime() < b.getPostTime(); });
+        session->pendingMoves += std::min(above, size - above);
+        break;
+    }
+    case FIFO_STORAGE:
+    case WEIGHT_ORDERED_STORAGE:
+    default:
+        //* Sem peso todos os pacotes empatam, e empates saem em ordem de chegada
+        stack->pushBottom(pkg);
+        break;
     }
-    return 0; // Retorna 0 se a seção não existir
 }
 
-void Warehouse::storePackage(Package* pkg, int destinationId) {
-    if (destinationId >= 0 && destinationId < this->totalWarehouses) {
-        this->sessions[destinationId].stack.push(pkg);
+int Warehouse::takePendingMoves(int destinationId) noexcept {
+    Session* session = this->sessions.find(destinationId);
+    if (session == nullptr) {
+        return 0;
     }
+    int moves = session->pendingMoves;
+    session->pendingMoves = 0;
+    return moves;
 }
 
-Package* Warehouse::retrievePackage(int destinationId) {
-    if (destinationId >= 0 && destinationId < this->totalWarehouses) {
-        return this->sessions[destinationId].stack.pop();
+Package Warehouse::retrievePackage(int destinationId) {
+    IntrusiveStack* stack = sectionFor(destinationId);
+    if (stack) {
+        return stack->pop();
     }
-    return nullptr;
+    return Package();
 }
 
-const Package* Warehouse::peekAtSection(int destinationId) const {
-    if (destinationId >= 0 && destinationId < this->totalWarehouses) {
-        return this->sessions[destinationId].stack.peek();
+int Warehouse::retrievePackages(int destinationId, int count, Package* out) {
+    IntrusiveStack* stack = sectionFor(destinationId);
+    if (stack) {
+        stack->popTop(count, out);
+        return count;
     }
-    return nullptr;
+    return 0;
 }
 
-bool Warehouse::isSectionEmpty(int destinationId) const {
+void Warehouse::restorePackages(int destinationId, const Package* packages, int count) {
+    IntrusiveStack* stack = sectionFor(destinationId);
+    if (stack) {
+        stack->pushRange(packages, count);
+    }
+}
+
+Package Warehouse::peekAtSection(int destinationId) const {
     if (destinationId >= 0 && destinationId < this->totalWarehouses) {
-        return this->sessions[destinationId].stack.isEmpty();
+        return sectionAt(destinationId).peek();
     }
-    return true;
-}
\ No newline at end of file
+    return Package();
+}
+
+bool Warehouse::isSectionEmpty(int destinationId) const {
+    return sectionAt(destinationId).isEmpty();
+}
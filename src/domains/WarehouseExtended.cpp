@@ -1,29 +1,68 @@
 #include "../../include/domains/WarehouseExtended.h"
 #include "../../include/domains/PackageExtended.h"
 #include "../../include/utils/Logger.h"
+#include "../../include/utils/RegionArena.h"
+#include <algorithm>
 #include <iostream>
 
-WarehouseExtended::WarehouseExtended(int ID, int totalWarehouses, int capacity, int weightCapacity)
-    : ID(ID), totalWarehouses(totalWarehouses), totalCapacity(capacity), totalOccupancy(0), totalWeightCapacity(weightCapacity), totalCurrentWeight(0), secondaryStorageId(-1),
-      hasSecondaryStorage(false) {
+WarehouseExtended::WarehouseExtended(int ID, int totalWarehouses, NeighborView neighbors, int capacity, int weightCapacity, RegionArena* arena, StoragePolicy storagePolicy)
+    : ID(ID), sections(neighbors, arena), totalWarehouses(totalWarehouses), totalCapacity(capacity), totalOccupancy(0), totalWeightCapacity(weightCapacity), totalCurrentWeight(0),
+      secondaryStorageId(-1), hasSecondaryStorage(false), storagePolicy(storagePolicy), lastOptimizationTime(-1) {
 
-    sections = new SectionExtended[totalWarehouses];
+    // Capacidade distribuída igualmente entre todos os destinos possíveis, como se cada um tivesse seção
+    blankSection.maxCapacity = capacity / totalWarehouses;
+    blankSection.weightCapacity = weightCapacity / totalWarehouses;
+    blankSection.currentOccupancy = 0;
+    blankSection.currentWeight = 0;
 
-    // Inicializa seções com capacidade distribuída igualmente
-    int sectionCapacity = capacity / totalWarehouses;
-    int sectionWeightCapacity = weightCapacity / totalWarehouses;
+    for (int slot = 0; slot < sections.getNumSections(); ++slot) {
+        sections.at(slot).maxCapacity = blankSection.maxCapacity;
+        sections.at(slot).weightCapacity = blankSection.weightCapacity;
+    }
+}
+
+WarehouseExtended::~WarehouseExtended() {}
 
-    for (int i = 0; i < totalWarehouses; ++i) {
-        sections[i].destinationId = i;
-        sections[i].maxCapacity = sectionCapacity;
-        sections[i].weightCapacity = sectionWeightCapacity;
-        sections[i].currentOccupancy = 0;
-        sections[i].currentWeight = 0;
+SectionExtended* WarehouseExtended::sectionFor(int destinationId) {
+    if (destinationId < 0 || destinationId >= totalWarehouses) {
+        return nullptr;
     }
+    SectionExtended* section = sections.find(destinationId);
+    if (section == nullptr) {
+        section = &sections.insert(destinationId);
+        section->maxCapacity = blankSection.maxCapacity;
+        section->weightCapacity = blankSection.weightCapacity;
+    }
+    return section;
+}
+
+const SectionExtended& WarehouseExtended::sectionAt(int destinationId) const noexcept {
+    const SectionExtended* section = sections.find(destinationId);
+    return section ? *section : blankSection;
 }
 
-WarehouseExtended::~WarehouseExtended() {
-    delete[] sections;
+void WarehouseExtended::placeInSection(SectionExtended& section, const PackageExtended& pkg) {
+    int size = section.stack.getCurrentSize();
+    int above = 0;
+    switch (storagePolicy) {
+    case FIFO_STORAGE:
+        section.stack.pushBottom(pkg);
+        break;
+    case AGE_PRIORITY_STORAGE:
+        above = section.stack.insertOrdered(pkg, [](const Package& a, const Package& b) { return a.getPostTime() < b.getPostTime(); });
+        section.pendingMoves += std::min(above, size - above);
+        break;
+    case WEIGHT_ORDERED_STORAGE:
+        above = section.stack.insertOrdered(pkg, [](const Package& a, const Package& b) {
+            return PackageExtended(a).getWeight() < PackageExtended(b).getWeight();
+        });
+        section.pendingMoves += std::min(above, size - above);
+        break;
+    case LIFO_STORAGE:
+    default:
+        section.stack.push(pkg);
+        break;
+    }
 }
 
 int WarehouseExtended::getId() const noexcept {
@@ -46,6 +85,10 @@ int WarehouseExtended::getTotalCurrentWeight() const noexcept {
     return totalCurrentWeight;
 }
 
+StoragePolicy WarehouseExtended::getStoragePolicy() const noexcept {
+    return storagePolicy;
+}
+
 double WarehouseExtended::getUtilizationPercentage() const noexcept {
     if (totalCapacity == 0)
         return 0.0;
@@ -53,49 +96,53 @@ double WarehouseExtended::getUtilizationPercentage() const noexcept {
 }
 
 int WarehouseExtended::getSectionSize(int sectionId) const noexcept {
-    if (sectionId >= 0 && sectionId < totalWarehouses) {
-        return sections[sectionId].stack.getCurrentSize();
-    }
-    return 0;
+    return sectionAt(sectionId).stack.getCurrentSize();
 }
 
 int WarehouseExtended::getSectionAvailableCapacity(int sectionId) const noexcept {
     if (sectionId >= 0 && sectionId < totalWarehouses) {
-        return sections[sectionId].maxCapacity - sections[sectionId].currentOccupancy;
+        const SectionExtended& section = sectionAt(sectionId);
+        return section.maxCapacity - section.currentOccupancy;
     }
     return 0;
 }
 
 int WarehouseExtended::getSectionAvailableWeight(int sectionId) const noexcept {
     if (sectionId >= 0 && sectionId < totalWarehouses) {
-        return sections[sectionId].weightCapacity - sections[sectionId].currentWeight;
+        const SectionExtended& section = sectionAt(sectionId);
+        return section.weightCapacity - section.currentWeight;
     }
     return 0;
 }
 
-bool WarehouseExtended::canStorePackage(PackageExtended* pkg, int destinationId) const {
+bool WarehouseExtended::canStorePackage(const PackageExtended& pkg, int destinationId) const {
     if (!pkg || destinationId < 0 || destinationId >= totalWarehouses) {
         return false;
     }
 
-    const SectionExtended& section = sections[destinationId];
-    int spaceRequired = pkg->getStorageSpaceRequired();
-    int weightRequired = pkg->getWeight();
+    const SectionExtended& section = sectionAt(destinationId);
+    int spaceRequired = pkg.getStorageSpaceRequired();
+    int weightRequired = pkg.getWeight();
 
     return (section.currentOccupancy + spaceRequired <= section.maxCapacity) && (section.currentWeight + weightRequired <= section.weightCapacity);
 }
 
-bool WarehouseExtended::storePackage(PackageExtended* pkg, int destinationId) {
+bool WarehouseExtended::storePackage(const PackageExtended& pkg, int destinationId, bool countArrival) {
+    // A demanda inclui os pacotes que vão para a fila de espera
+    if (countArrival && destinationId >= 0 && destinationId < totalWarehouses) {
+        sectionFor(destinationId)->recentArrivals++;
+    }
+
     if (!canStorePackage(pkg, destinationId)) {
         // Tenta armazenar na fila de espera e retorna o resultado
         return storeInWaitingQueue(pkg, destinationId);
     }
 
-    SectionExtended& section = sections[destinationId];
-    section.stack.push(pkg);
+    SectionExtended& section = *sectionFor(destinationId);
+    placeInSection(section, pkg);
 
-    int spaceRequired = pkg->getStorageSpaceRequired();
-    int weightRequired = pkg->getWeight();
+    int spaceRequired = pkg.getStorageSpaceRequired();
+    int weightRequired = pkg.getWeight();
 
     section.currentOccupancy += spaceRequired;
     section.currentWeight += weightRequired;
@@ -105,37 +152,37 @@ bool WarehouseExtended::storePackage(PackageExtended* pkg, int destinationId) {
     return true;
 }
 
-bool WarehouseExtended::storeInWaitingQueue(PackageExtended* pkg, int destinationId) {
-    if (destinationId < 0 || destinationId >= totalWarehouses) {
+bool WarehouseExtended::storeInWaitingQueue(const PackageExtended& pkg, int destinationId) {
+    SectionExtended* section = sectionFor(destinationId);
+    if (section == nullptr) {
         return false;
     }
 
-    SectionExtended& section = sections[destinationId];
-    section.waitingQueue.enqueue(pkg);
+    section->waitingQueue.enqueue(pkg);
 
     // Log overflow event
-    logPackageWaitingDueToCapacity(0, pkg->getId(), ID, destinationId); // Timer would be passed from caller
+    logPackageWaitingDueToCapacity(0, pkg.getId(), ID, destinationId); // Timer would be passed from caller
 
     return true;
 }
 
 void WarehouseExtended::processWaitingQueue(int destinationId) {
-    if (destinationId < 0 || destinationId >= totalWarehouses) {
-        return;
+    SectionExtended* found = sections.find(destinationId);
+    if (found == nullptr) {
+        return; // Sem seção não há fila de espera
     }
 
-    SectionExtended& section = sections[destinationId];
-
+    SectionExtended& section = *found;
     while (!section.waitingQueue.isEmpty()) {
-        PackageExtended* pkg = static_cast<PackageExtended*>(section.waitingQueue.peek());
+        PackageExtended pkg(section.waitingQueue.peek());
 
         if (canStorePackage(pkg, destinationId)) {
             section.waitingQueue.dequeue();
             // Directly store in main storage without calling storePackage to avoid recursion
-            section.stack.push(pkg);
+            placeInSection(section, pkg);
 
-            int spaceRequired = pkg->getStorageSpaceRequired();
-            int weightRequired = pkg->getWeight();
+            int spaceRequired = pkg.getStorageSpaceRequired();
+            int weightRequired = pkg.getWeight();
 
             section.currentOccupancy += spaceRequired;
             section.currentWeight += weightRequired;
@@ -147,17 +194,28 @@ void WarehouseExtended::processWaitingQueue(int destinationId) {
     }
 }
 
-PackageExtended* WarehouseExtended::retrievePackage(int destinationId) {
-    if (destinationId < 0 || destinationId >= totalWarehouses) {
-        return nullptr;
+int WarehouseExtended::takePendingMoves(int destinationId) noexcept {
+    SectionExtended* found = sections.find(destinationId);
+    if (found == nullptr) {
+        return 0;
+    }
+    int moves = found->pendingMoves;
+    found->pendingMoves = 0;
+    return moves;
+}
+
+PackageExtended WarehouseExtended::retrievePackage(int destinationId) {
+    SectionExtended* found = sectionFor(destinationId);
+    if (found == nullptr) {
+        return PackageExtended();
     }
 
-    SectionExtended& section = sections[destinationId];
-    PackageExtended* pkg = static_cast<PackageExtended*>(section.stack.pop());
+    SectionExtended& section = *found;
+    PackageExtended pkg(section.stack.pop());
 
     if (pkg) {
-        int spaceFreed = pkg->getStorageSpaceRequired();
-        int weightFreed = pkg->getWeight();
+        int spaceFreed = pkg.getStorageSpaceRequired();
+        int weightFreed = pkg.getWeight();
 
         section.currentOccupancy -= spaceFreed;
         section.currentWeight -= weightFreed;
@@ -171,23 +229,85 @@ PackageExtended* WarehouseExtended::retrievePackage(int destinationId) {
     return pkg;
 }
 
-const PackageExtended* WarehouseExtended::peekAtSection(int destinationId) const {
-    if (destinationId >= 0 && destinationId < totalWarehouses) {
-        return static_cast<const PackageExtended*>(sections[destinationId].stack.peek());
+int WarehouseExtended::retrievePackages(int destinationId, int count, PackageExtended* out) {
+    SectionExtended* found = sectionFor(destinationId);
+    if (found == nullptr) {
+        return 0;
+    }
+
+    SectionExtended& section = *found;
+    if (!section.waitingQueue.isEmpty()) {
+        for (int i = 0; i < count; ++i) {
+            out[i] = retrievePackage(destinationId);
+        }
+        return count;
+    }
+
+    // Sem fila de espera nenhuma saída admite outro pacote: só a contabilidade acompanha cada pop
+    for (int i = 0; i < count; ++i) {
+        out[i] = PackageExtended(section.stack.pop());
+        int spaceFreed = out[i].getStorageSpaceRequired();
+        int weightFreed = out[i].getWeight();
+        section.currentOccupancy -= spaceFreed;
+        section.currentWeight -= weightFreed;
+        totalOccupancy -= spaceFreed;
+        totalCurrentWeight -= weightFreed;
     }
-    return nullptr;
+    return count;
 }
 
-bool WarehouseExtended::isSectionEmpty(int destinationId) const {
+int WarehouseExtended::removePackagesIf(int destinationId, const std::function<bool(const PackageExtended&)>& shouldRemove, PackageExtended* removed) {
+    SectionExtended* found = sections.find(destinationId);
+    if (found == nullptr) {
+        return 0;
+    }
+
+    // Os pacotes escolhidos são desencadeados no lugar; os demais mantêm a ordem
+    SectionExtended& section = *found;
+    int numRemoved = 0;
+    section.stack.removeIf([&](const Package& package) {
+        PackageExtended pkg(package);
+        if (!shouldRemove(pkg)) {
+            return false;
+        }
+        removed[numRemoved++] = pkg;
+        section.currentOccupancy -= pkg.getStorageSpaceRequired();
+        section.currentWeight -= pkg.getWeight();
+        totalOccupancy -= pkg.getStorageSpaceRequired();
+        totalCurrentWeight -= pkg.getWeight();
+        return true;
+    });
+
+    // A fila de espera é filtrada antes de admitir qualquer pacote dela na seção (ela não ocupa capacidade)
+    section.waitingQueue.removeIf([&](const Package& package) {
+        PackageExtended pkg(package);
+        if (!shouldRemove(pkg)) {
+            return false;
+        }
+        removed[numRemoved++] = pkg;
+        return true;
+    });
+
+    if (numRemoved > 0) {
+        processWaitingQueue(destinationId);
+    }
+    return numRemoved;
+}
+
+PackageExtended WarehouseExtended::peekAtSection(int destinationId) const {
     if (destinationId >= 0 && destinationId < totalWarehouses) {
-        return sections[destinationId].stack.isEmpty();
+        return PackageExtended(sectionAt(destinationId).stack.peek());
     }
-    return true;
+    return PackageExtended();
+}
+
+bool WarehouseExtended::isSectionEmpty(int destinationId) const {
+    return sectionAt(destinationId).stack.isEmpty();
 }
 
 bool WarehouseExtended::isSectionOverCapacity(int destinationId) const {
     if (destinationId >= 0 && destinationId < totalWarehouses) {
-        const SectionExtended& section = sections[destinationId];
+        const SectionExtended& section = sectionAt(destinationId);
         return section.currentOccupancy > section.maxCapacity || section.currentWeight > section.weightCapacity;
     }
     return false;
@@ -198,7 +318,7 @@ void WarehouseExtended::setSecondaryStorage(int warehouseId) {
     hasSecondaryStorage = true;
 }
 
-bool WarehouseExtended::transferToSecondaryStorage(PackageExtended* pkg, int destinationId, WarehouseExtended** warehouses) {
+bool WarehouseExtended::transferToSecondaryStorage(const PackageExtended& pkg, int destinationId, WarehouseExtended** warehouses) {
     if (!hasSecondaryStorage || secondaryStorageId < 0 || !pkg || !warehouses) {
         return false;
     }
@@ -212,17 +332,66 @@ bool WarehouseExtended::transferToSecondaryStorage(PackageExtended* pkg, int des
 }
 
 int WarehouseExtended::getWaitingQueueSize(int destinationId) const noexcept {
-    if (destinationId >= 0 && destinationId < totalWarehouses) {
-        return sections[destinationId].waitingQueue.getSize();
-    }
-    return 0;
+    return sectionAt(destinationId).waitingQueue.getSize();
 }
 
 void WarehouseExtended::logPackageWaitingDueToCapacity(int time, int pkgId, int whId, int sectionId) {
     std::cout << "[" << time << "] Pacote " << pkgId << " aguardando capacidade no armazém " << whId << " seção " << sectionId << std::endl;
 }
 
-void WarehouseExtended::optimizeCapacity() {
-    // Implementation for capacity optimization could be added here
-    // For now, this is a placeholder
+void WarehouseExtended::optimizeCapacity(int currentTime) {
+    if (currentTime == lastOptimizationTime) {
+        return;
+    }
+    lastOptimizationTime = currentTime;
+
+    int numSections = sections.getNumSections();
+    if (numSections == 0) {
+        return;
+    }
+
+    // Atualiza as taxas suavizadas com as chegadas do intervalo que terminou
+    double totalRate = 0.0;
+    int busiestSlot = 0;
+    for (int slot = 0; slot < numSections; ++slot) {
+        SectionExtended& section = sections.at(slot);
+        section.arrivalRate = ARRIVAL_RATE_SMOOTHING * section.recentArrivals + (1.0 - ARRIVAL_RATE_SMOOTHING) * section.arrivalRate;
+        section.recentArrivals = 0;
+        totalRate += section.arrivalRate;
+        if (section.arrivalRate > sections.at(busiestSlot).arrivalRate) {
+            busiestSlot = slot;
+        }
+    }
+
+    // Toda seção mantém um mínimo (uma fração da parcela estática) para não bloquear destinos que voltem a ser usados
+    //* Seções existem só para destinos válidos, então numSections <= totalWarehouses e o excedente nunca é negativo
+    int minCapacity = std::max(1, static_cast<int>(blankSection.maxCapacity * MIN_SECTION_SHARE));
+    int minWeight = std::max(1, static_cast<int>(blankSection.weightCapacity * MIN_SECTION_SHARE));
+    int spareCapacity = std::max(0, totalCapacity - numSections * minCapacity);
+    int spareWeight = std::max(0, totalWeightCapacity - numSections * minWeight);
+    int assignedCapacity = 0;
+    int assignedWeight = 0;
+
+    for (int slot = 0; slot < numSections; ++slot) {
+        SectionExtended& section = sections.at(slot);
+        // Sem chegadas recentes em nenhuma seção o excedente é dividido igualmente
+        double share = totalRate > 0.0 ? section.arrivalRate / totalRate : 1.0 / numSections;
+        int extraCapacity = static_cast<int>(spareCapacity * share);
+        int extraWeight = static_cast<int>(spareWeight * share);
+        section.maxCapacity = minCapacity + extraCapacity;
+        section.weightCapacity = minWeight + extraWeight;
+        assignedCapacity += extraCapacity;
+        assignedWeight += extraWeight;
+    }
+
+    // O que sobrou dos arredondamentos vai para a seção mais demandada
+    sections.at(busiestSlot).maxCapacity += spareCapacity - assignedCapacity;
+    sections.at(busiestSlot).weightCapacity += spareWeight - assignedWeight;
+
+    // Seções que ganharam espaço admitem pacotes da fila de espera
+    for (int slot = 0; slot < numSections; ++slot) {
+        if (!sections.at(slot).waitingQueue.isEmpty()) {
+            processWaitingQueue(sections.getDestination(slot));
+        }
+    }
 }
\ No newline at end of file
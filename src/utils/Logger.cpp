@@ -8,6 +8,8 @@ extern "C" void recordMetricsTransportEvent();
 extern "C" void recordMetricsDelivery(double time);
 
 //@ Funções auxiliares de log
+//* Os IDs de armazém e seção já chegam com a numeração do arquivo de entrada (o escalonador traduz os internos)
+
 void printFormattedTime(int time) {
     std::cout << std::setw(7) << std::setfill('0') << time;
 }
@@ -44,4 +46,34 @@ void logPackageRestored(int time, int pkgId, int whId, int sectionId) {
 
     // Record rearrangement for metrics
     recordMetricsRearrangement();
+}
+
+void logPackageUndeliverable(int time, int pkgId, int whId) {
+    printFormattedTime(time);
+    std::cout << " pacote " << std::setw(3) << pkgId << " sem rota em " << std::setw(3) << whId << std::endl;
+}
+
+void logSectionReshelved(int time, int whId, int sectionId, int numPackages) {
+    printFormattedTime(time);
+    std::cout << " secao " << std::setw(3) << sectionId << " de " << std::setw(3) << whId << " reorganizada com " << numPackages << " pacotes rearmazenados" << std::endl;
+
+    // Cada pacote deslocado conta como um rearmazenamento nas métricas
+    for (int i = 0; i < numPackages; ++i) {
+        recordMetricsRearrangement();
+    }
+}
+
+void logEdgeClosed(int time, int originId, int destId) {
+    printFormattedTime(time);
+    std::cout << " aresta " << std::setw(3) << originId << " - " << std::setw(3) << destId << " fechada" << std::endl;
+}
+
+void logEdgeReopened(int time, int originId, int destId) {
+    printFormattedTime(time);
+    std::cout << " aresta " << std::setw(3) << originId << " - " << std::setw(3) << destId << " reaberta" << std::endl;
+}
+
+void logEdgeLatencyChanged(int time, int originId, int destId, int latency) {
+    printFormattedTime(time);
+    std::cout << " aresta " << std::setw(3) << originId << " - " << std::setw(3) << destId << " com latencia " << latency << std::endl;
 }
\ No newline at end of file
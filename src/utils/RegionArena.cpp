@@ -0,0 +1,84 @@
+#include "../../include/utils/RegionArena.h"
+
+#include <sys/mman.h>
+
+RegionArena::RegionArena(bool hugePages)
+    : chunks(nullptr), cursor(nullptr), limit(nullptr), nextChunkSize(INITIAL_CHUNK_SIZE), hugePages(hugePages), bytesAllocated(0), bytesReserved(0), finalizers(nullptr) {}
+
+RegionArena::~RegionArena() {
+    release();
+}
+
+void* RegionArena::allocateSlow(size_t size, size_t alignment) {
+    //* O bloco precisa caber o cabeçalho, a folga de alinhamento e o pedido
+    size_t needed = sizeof(Chunk) + alignment + size;
+    size_t chunkSize = nextChunkSize;
+    while (chunkSize < needed) {
+        chunkSize *= 2;
+    }
+
+    Chunk* chunk = mapChunk(chunkSize);
+    chunk->previous = chunks;
+    chunks = chunk;
+    bytesReserved += chunk->size;
+    if (nextChunkSize < MAX_CHUNK_SIZE) {
+        nextChunkSize *= 2;
+    }
+
+    cursor = reinterpret_cast<char*>(chunk) + sizeof(Chunk);
+    limit = reinterpret_cast<char*>(chunk) + chunk->size;
+    return allocate(size, alignment);
+}
+
+RegionArena::Chunk* RegionArena::mapChunk(size_t size) {
+    void* memory = MAP_FAILED;
+
+    if (hugePages) {
+        size = (size + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+#ifdef MAP_HUGETLB
+        // Páginas grandes reservadas pelo sistema (hugetlbfs); se não houver, cai no mapeamento comum
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    }
+
+    if (memory == MAP_FAILED) {
+        memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        if (hugePages) {
+            //* Páginas grandes transparentes: só uma sugestão, ignorada se o sistema não suportar
+            madvise(memory, size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    Chunk* chunk = static_cast<Chunk*>(memory);
+    chunk->size = size;
+    return chunk;
+}
+
+void RegionArena::unmapChunk(Chunk* chunk) noexcept {
+    munmap(chunk, chunk->size);
+}
+
+void RegionArena::release() noexcept {
+    // Os destrutores rodam antes de qualquer bloco ser devolvido (os finalizadores também estão nos blocos)
+    for (Finalizer* finalizer = finalizers; finalizer != nullptr; finalizer = finalizer->previous) {
+        finalizer->destroy(finalizer->object);
+    }
+    finalizers = nullptr;
+
+    while (chunks != nullptr) {
+        Chunk* previous = chunks->previous;
+        unmapChunk(chunks);
+        chunks = previous;
+    }
+
+    cursor = nullptr;
+    limit = nullptr;
+    nextChunkSize = INITIAL_CHUNK_SIZE;
+    bytesAllocated = 0;
+    bytesReserved = 0;
+}
@@ -0,0 +1,195 @@
+#include "../../include/utils/SlabAllocator.h"
+
+#include <stdexcept>
+
+#ifdef __GNUG__
+#include <cxxabi.h>
+#include <cstdlib>
+#endif
+
+namespace {
+
+//@ Pools registrados, na ordem de criação (uma entrada vira nullptr quando o pool é destruído)
+std::mutex registryMutex;
+SlabPool* registry[SlabPool::MAX_POOLS];
+int numRegistered = 0;
+
+//@ Converte o nome de typeid no nome legível do tipo (quando o compilador permite)
+std::string readableName(const std::string& name) {
+#ifdef __GNUG__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr) {
+        std::string result(demangled);
+        std::free(demangled);
+        return result;
+    }
+#endif
+    return name;
+}
+
+} // namespace
+
+thread_local SlabPool::LocalCache SlabPool::localCaches[SlabPool::MAX_POOLS];
+
+//@ Objeto por thread cujo destrutor devolve os caches da thread aos pools
+//@ (na thread principal, roda antes da destruição dos pools estáticos)
+struct SlabThreadExit {
+    ~SlabThreadExit() {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (int i = 0; i < numRegistered; ++i) {
+            if (registry[i] != nullptr) {
+                registry[i]->flush(SlabPool::localCaches[i]);
+            }
+        }
+    }
+};
+
+SlabPool::SlabPool(const std::string& name, size_t objectSize, size_t alignment, int objectsPerSlab)
+    : name(readableName(name)), objectSize(0), alignment(alignment < alignof(FreeNode) ? alignof(FreeNode) : alignment), objectsPerSlab(objectsPerSlab),
+      index(-1), freeList(nullptr), slabs(nullptr), numSlabs(0), slabsCapacity(0), allocations(0), deallocations(0) {
+    if (objectsPerSlab <= 0) {
+        throw std::invalid_argument("O número de objetos por slab deve ser positivo.");
+    }
+
+    //* Cada objeto precisa caber um FreeNode e manter o alinhamento dos seguintes
+    size_t size = objectSize < sizeof(FreeNode) ? sizeof(FreeNode) : objectSize;
+    this->objectSize = (size + this->alignment - 1) / this->alignment * this->alignment;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    if (numRegistered == MAX_POOLS) {
+        throw std::length_error("Limite de pools de alocação atingido.");
+    }
+    index = numRegistered++;
+    registry[index] = this;
+}
+
+SlabPool::~SlabPool() {
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        registry[index] = nullptr;
+    }
+
+    //* O cache da thread que destrói o pool apontaria para slabs liberados
+    localCaches[index] = LocalCache();
+    for (int i = 0; i < numSlabs; ++i) {
+        ::operator delete(slabs[i], std::align_val_t(alignment));
+    }
+    delete[] slabs;
+}
+
+void* SlabPool::refill() {
+    registerThreadExit();
+
+    LocalCache& cache = localCaches[index];
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Lote da lista livre global
+    while (freeList != nullptr && cache.count < BATCH_SIZE) {
+        FreeNode* node = freeList;
+        freeList = node->next;
+        node->next = cache.head;
+        cache.head = node;
+        cache.count++;
+    }
+
+    // Lista global vazia: um slab novo vai inteiro para o cache (em ordem de endereço)
+    if (cache.head == nullptr) {
+        if (numSlabs == slabsCapacity) {
+            int newCapacity = slabsCapacity == 0 ? 16 : 2 * slabsCapacity;
+            void** newSlabs = new void*[newCapacity];
+            for (int i = 0; i < numSlabs; ++i) {
+                newSlabs[i] = slabs[i];
+            }
+            delete[] slabs;
+            slabs = newSlabs;
+            slabsCapacity = newCapacity;
+        }
+
+        char* slab = static_cast<char*>(::operator new(objectSize * objectsPerSlab, std::align_val_t(alignment)));
+        slabs[numSlabs++] = slab;
+        for (int i = objectsPerSlab - 1; i >= 0; --i) {
+            FreeNode* node = reinterpret_cast<FreeNode*>(slab + i * objectSize);
+            node->next = cache.head;
+            cache.head = node;
+        }
+        cache.count += objectsPerSlab;
+    }
+
+    FreeNode* node = cache.head;
+    cache.head = node->next;
+    cache.count--;
+    cache.allocations++;
+    return node;
+}
+
+void SlabPool::drain(LocalCache& cache) noexcept {
+    FreeNode* first = cache.head;
+    FreeNode* last = first;
+    for (int i = 1; i < BATCH_SIZE; ++i) {
+        last = last->next;
+    }
+    cache.head = last->next;
+    cache.count -= BATCH_SIZE;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    last->next = freeList;
+    freeList = first;
+    allocations += cache.allocations;
+    deallocations += cache.deallocations;
+    cache.allocations = 0;
+    cache.deallocations = 0;
+}
+
+void SlabPool::flush(LocalCache& cache) noexcept {
+    std::lock_guard<std::mutex> lock(mutex);
+    while (cache.head != nullptr) {
+        FreeNode* node = cache.head;
+        cache.head = node->next;
+        node->next = freeList;
+        freeList = node;
+    }
+    cache.count = 0;
+    allocations += cache.allocations;
+    deallocations += cache.deallocations;
+    cache.allocations = 0;
+    cache.deallocations = 0;
+}
+
+void SlabPool::registerThreadExit() noexcept {
+    static thread_local SlabThreadExit guard;
+    (void)guard;
+}
+
+SlabPoolStats SlabPool::getStats() {
+    const LocalCache& cache = localCaches[index];
+    SlabPoolStats stats;
+    stats.name = name;
+    stats.objectSize = static_cast<int>(objectSize);
+    stats.allocations = allocations + cache.allocations;
+    stats.deallocations = deallocations + cache.deallocations;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.slabs = numSlabs;
+    stats.reservedObjects = static_cast<long long>(numSlabs) * objectsPerSlab;
+    return stats;
+}
+
+int SlabPool::getNumPools() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    return numRegistered;
+}
+
+SlabPoolStats SlabPool::getStats(int poolIndex) {
+    SlabPool* pool = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        if (poolIndex >= 0 && poolIndex < numRegistered) {
+            pool = registry[poolIndex];
+        }
+    }
+    if (pool == nullptr) {
+        throw std::out_of_range("Pool de alocação inexistente.");
+    }
+    return pool->getStats();
+}
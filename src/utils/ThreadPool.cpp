@@ -0,0 +1,113 @@
+#include "../../include/utils/ThreadPool.h"
+
+ThreadPool::ThreadPool(int numThreads) : workers(nullptr), numWorkers(0), task(nullptr), nextIndex(0), endIndex(0), generation(0), pendingWorkers(0), stopping(false) {
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    if (numThreads <= 0) {
+        numThreads = 1;
+    }
+
+    //* A thread chamadora conta como um dos trabalhadores
+    numWorkers = numThreads - 1;
+    if (numWorkers > 0) {
+        workers = new std::thread[numWorkers];
+        for (int i = 0; i < numWorkers; ++i) {
+            workers[i] = std::thread(&ThreadPool::workerLoop, this, i + 1);
+        }
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    workAvailable.notify_all();
+
+    for (int i = 0; i < numWorkers; ++i) {
+        workers[i].join();
+    }
+    delete[] workers;
+}
+
+int ThreadPool::getNumThreads() const noexcept {
+    return numWorkers + 1;
+}
+
+void ThreadPool::parallelFor(int begin, int end, const std::function<void(int index, int workerId)>& body) {
+    if (end <= begin) {
+        return;
+    }
+
+    //* Sem threads auxiliares (ou com uma única iteração) executa em série
+    if (numWorkers == 0 || end - begin == 1) {
+        for (int i = begin; i < end; ++i) {
+            body(i, 0);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &body;
+        nextIndex.store(begin);
+        endIndex = end;
+        pendingWorkers = numWorkers;
+        ++generation;
+    }
+    workAvailable.notify_all();
+
+    runTasks(0);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    workDone.wait(lock, [this]() { return pendingWorkers == 0; });
+    task = nullptr;
+
+    std::exception_ptr error = firstError;
+    firstError = nullptr;
+    lock.unlock();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void ThreadPool::workerLoop(int workerId) {
+    int seenGeneration = 0;
+
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        workAvailable.wait(lock, [this, seenGeneration]() { return stopping || generation != seenGeneration; });
+        if (stopping) {
+            return;
+        }
+        seenGeneration = generation;
+        lock.unlock();
+
+        runTasks(workerId);
+
+        lock.lock();
+        if (--pendingWorkers == 0) {
+            workDone.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runTasks(int workerId) {
+    while (true) {
+        int index = nextIndex.fetch_add(1);
+        if (index >= endIndex) {
+            break;
+        }
+        try {
+            (*task)(index, workerId);
+        } catch (...) {
+            //* Guarda só a primeira exceção e esgota o intervalo para que os demais trabalhadores parem
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+            nextIndex.store(endIndex);
+        }
+    }
+}